@@ -125,7 +125,7 @@ INCDIRS := -I$(FBA_BURNER_DIR)/win32 \
 	-I$(LIBRETRO_COMM_DIR)/include \
 	-I$(FBA_LIB_DIR)
 
-COREFLAGS := $(INCDIRS) -fno-stack-protector -DUSE_SPEEDHACKS -D__LIBRETRO_OPTIMIZATIONS__ -D__LIBRETRO__ -Wno-write-strings -DUSE_FILE32API -DANDROID -DFRONTEND_SUPPORTS_RGB565 -DFBACORES_CPS -DEMU_M68K
+COREFLAGS := $(INCDIRS) -fno-stack-protector -DUSE_SPEEDHACKS -D__LIBRETRO_OPTIMIZATIONS__ -D__LIBRETRO__ -Wno-write-strings -DUSE_FILE32API -DANDROID -DFRONTEND_SUPPORTS_RGB565 -DFBACORES_CPS -DEMU_M68K -DHAVE_THREADS
 COREFLAGS += -Wno-c++11-narrowing
 
 GIT_VERSION := " $(shell git rev-parse --short HEAD || echo unknown)"
@@ -104,6 +104,9 @@ extern INT32 (__cdecl *BurnExtProgressUpdateCallback)(double dProgress, const TC
 // Application-defined catridge initialisation function
 extern INT32 (__cdecl *BurnExtCartridgeSetupCallback)(enum BurnCartrigeCommand nCommand);
 
+// Application-defined monotonic clock, enables the profiling sections when set
+extern UINT64 (__cdecl *BurnExtProfileClockCallback)(void);
+
 #if defined(FRONTEND_SUPPORTS_RGB565)
 #define BurnHighCol(r, g, b, i) ((((r) << 8) & 0xf800) | (((g) << 3) & 0x07e0) | (((b) >> 3) & 0x001f))
 #else
@@ -221,6 +224,39 @@ extern UINT32 *pBurnDrvPalette;
 INT32 BurnLibInit();
 INT32 BurnLibExit();
 
+// burn_prof.c
+enum BurnProfSection
+{
+   BURN_PROF_SEK,
+   BURN_PROF_QSND_Z80,
+   BURN_PROF_QSC,
+   BURN_PROF_OBJ,
+   BURN_PROF_DRAW,
+   BURN_PROF_DRAW_THREAD,		// Timed on the render thread, while the others run
+   BURN_PROF_COUNT
+};
+
+void BurnProfReset();
+void BurnProfEnter(INT32 nSection);
+void BurnProfLeave();
+void BurnProfAdd(INT32 nSection, UINT64 nTime);
+UINT64 BurnProfGetTime(INT32 nSection);
+UINT32 BurnProfGetCalls(INT32 nSection);
+const char* BurnProfGetName(INT32 nSection);
+
+#define BURN_PROF_ENTER(n)	do { if (BurnExtProfileClockCallback) BurnProfEnter(n); } while (0)
+#define BURN_PROF_LEAVE()	do { if (BurnExtProfileClockCallback) BurnProfLeave(); } while (0)
+
+// burn_thread.c
+#define BURN_THREAD_MAX	(8)
+
+INT32 BurnThreadInit(INT32 nCount);
+void BurnThreadExit();
+INT32 BurnThreadCount();
+void BurnThreadRun(void (*pJob)(INT32 nJob), INT32 nJobs);
+void BurnThreadAsync(void (*pJob)());
+void BurnThreadSync();
+
 INT32 BurnDrvInit();
 INT32 BurnDrvExit();
 
@@ -0,0 +1,98 @@
+// FB Alpha profiling module
+
+// Accumulates exclusive time per emulation subsystem.  Nothing is measured
+// unless the application installs BurnExtProfileClockCallback, so the
+// instrumentation costs a single pointer test in normal use.
+
+#include "burnint.h"
+
+#define BURN_PROF_DEPTH	8
+
+UINT64 (__cdecl *BurnExtProfileClockCallback)(void) = NULL;
+
+static UINT64 nProfTime[BURN_PROF_COUNT];
+static UINT32 nProfCalls[BURN_PROF_COUNT];
+static INT32 nProfStack[BURN_PROF_DEPTH];
+static INT32 nProfDepth;
+static UINT64 nProfLast;
+
+static const char* szProfName[BURN_PROF_COUNT] = {
+	"SekRun",
+	"QSound Z80",
+	"QscUpdate",
+	"CpsObjGet",
+	"CpsDraw",
+	"DrawThread",
+};
+
+void BurnProfReset(void)
+{
+	memset(nProfTime, 0, sizeof(nProfTime));
+	memset(nProfCalls, 0, sizeof(nProfCalls));
+	nProfDepth = 0;
+}
+
+// Charge the time since the last transition to the section on top of the stack,
+// so nested sections (e.g. QscUpdate called from a Z80 write) are not counted twice
+void BurnProfEnter(INT32 nSection)
+{
+	UINT64 nNow = BurnExtProfileClockCallback();
+
+	if (nProfDepth > 0 && nProfDepth <= BURN_PROF_DEPTH)
+		nProfTime[nProfStack[nProfDepth - 1]] += nNow - nProfLast;
+
+	if (nProfDepth < BURN_PROF_DEPTH)
+		nProfStack[nProfDepth] = nSection;
+	nProfDepth++;
+	nProfCalls[nSection]++;
+
+	nProfLast = nNow;
+}
+
+void BurnProfLeave(void)
+{
+	UINT64 nNow = BurnExtProfileClockCallback();
+
+	if (nProfDepth <= 0)
+		return;
+
+	nProfDepth--;
+	if (nProfDepth < BURN_PROF_DEPTH)
+		nProfTime[nProfStack[nProfDepth]] += nNow - nProfLast;
+
+	nProfLast = nNow;
+}
+
+// Add time measured outside the stack, e.g. on another thread, to a section
+void BurnProfAdd(INT32 nSection, UINT64 nTime)
+{
+	if (nSection < 0 || nSection >= BURN_PROF_COUNT)
+		return;
+
+	nProfTime[nSection] += nTime;
+	nProfCalls[nSection]++;
+}
+
+UINT64 BurnProfGetTime(INT32 nSection)
+{
+	if (nSection < 0 || nSection >= BURN_PROF_COUNT)
+		return 0;
+
+	return nProfTime[nSection];
+}
+
+UINT32 BurnProfGetCalls(INT32 nSection)
+{
+	if (nSection < 0 || nSection >= BURN_PROF_COUNT)
+		return 0;
+
+	return nProfCalls[nSection];
+}
+
+const char* BurnProfGetName(INT32 nSection)
+{
+	if (nSection < 0 || nSection >= BURN_PROF_COUNT)
+		return NULL;
+
+	return szProfName[nSection];
+}
@@ -0,0 +1,227 @@
+// FB Alpha worker threads
+
+// A small pool of worker threads for splitting up per frame work, e.g. drawing
+// the screen in bands.  BurnThreadRun() hands out jobs 0 to nJobs-1, runs job 0
+// on the calling thread and returns once they have all finished.  Without
+// HAVE_THREADS (or with a pool of one) the jobs simply run in turn.
+//
+// There is also one separate thread for work that can overlap the rest of the
+// frame: BurnThreadAsync() starts a job on it and returns straight away, and
+// BurnThreadSync() waits for that job to finish.
+
+#include "burnint.h"
+
+#if defined(HAVE_THREADS)
+#include <pthread.h>
+#endif
+
+static INT32 nThreadCount = 1;				// Including the calling thread
+
+#if defined(HAVE_THREADS)
+static pthread_t ThreadId[BURN_THREAD_MAX];
+static pthread_mutex_t ThreadMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t ThreadWork = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t ThreadDone = PTHREAD_COND_INITIALIZER;
+
+static void (*pThreadJob)(INT32 nJob);
+static INT32 nJobNext, nJobCount, nJobsLeft;
+static UINT32 nJobBatch;					// Bumped for each BurnThreadRun
+static INT32 bThreadQuit;
+
+static pthread_t AsyncId;
+static pthread_mutex_t AsyncMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t AsyncWork = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t AsyncDone = PTHREAD_COND_INITIALIZER;
+
+static void (*pAsyncJob)();					// NULL when the async thread is idle
+static INT32 bAsyncStarted, bAsyncQuit;
+
+// Run jobs until there are none left to start, called with ThreadMutex held
+static void BurnThreadTakeJobs(void)
+{
+	while (nJobNext < nJobCount) {
+		INT32 nJob = nJobNext++;
+
+		pthread_mutex_unlock(&ThreadMutex);
+		pThreadJob(nJob);
+		pthread_mutex_lock(&ThreadMutex);
+
+		if (--nJobsLeft == 0)
+			pthread_cond_signal(&ThreadDone);
+	}
+}
+
+static void* BurnThreadMain(void* pArg)
+{
+	UINT32 nSeen = 0;
+
+	(void)pArg;
+
+	pthread_mutex_lock(&ThreadMutex);
+	for (;;) {
+		while (!bThreadQuit && nSeen == nJobBatch)
+			pthread_cond_wait(&ThreadWork, &ThreadMutex);
+
+		if (bThreadQuit)
+			break;
+
+		nSeen = nJobBatch;
+		BurnThreadTakeJobs();
+	}
+	pthread_mutex_unlock(&ThreadMutex);
+
+	return NULL;
+}
+
+static void* BurnThreadAsyncMain(void* pArg)
+{
+	(void)pArg;
+
+	pthread_mutex_lock(&AsyncMutex);
+	for (;;) {
+		while (!bAsyncQuit && pAsyncJob == NULL)
+			pthread_cond_wait(&AsyncWork, &AsyncMutex);
+
+		if (bAsyncQuit)
+			break;
+
+		pthread_mutex_unlock(&AsyncMutex);
+		pAsyncJob();
+		pthread_mutex_lock(&AsyncMutex);
+
+		pAsyncJob = NULL;
+		pthread_cond_signal(&AsyncDone);
+	}
+	pthread_mutex_unlock(&AsyncMutex);
+
+	return NULL;
+}
+#endif
+
+// Start nCount - 1 worker threads (the calling thread makes up the count)
+INT32 BurnThreadInit(INT32 nCount)
+{
+	BurnThreadExit();
+
+	if (nCount < 1)
+		nCount = 1;
+	if (nCount > BURN_THREAD_MAX)
+		nCount = BURN_THREAD_MAX;
+
+#if defined(HAVE_THREADS)
+	bThreadQuit = 0;
+
+	for (nThreadCount = 1; nThreadCount < nCount; nThreadCount++) {
+		if (pthread_create(&ThreadId[nThreadCount], NULL, BurnThreadMain, NULL) != 0)
+			return 1;								// Carry on with the threads we have
+	}
+#endif
+
+	return 0;
+}
+
+void BurnThreadExit()
+{
+#if defined(HAVE_THREADS)
+	INT32 i;
+
+	if (bAsyncStarted) {
+		BurnThreadSync();
+
+		pthread_mutex_lock(&AsyncMutex);
+		bAsyncQuit = 1;
+		pthread_cond_signal(&AsyncWork);
+		pthread_mutex_unlock(&AsyncMutex);
+
+		pthread_join(AsyncId, NULL);
+		bAsyncStarted = 0;
+	}
+
+	if (nThreadCount > 1) {
+		pthread_mutex_lock(&ThreadMutex);
+		bThreadQuit = 1;
+		pthread_cond_broadcast(&ThreadWork);
+		pthread_mutex_unlock(&ThreadMutex);
+
+		for (i = 1; i < nThreadCount; i++)
+			pthread_join(ThreadId[i], NULL);
+	}
+#endif
+
+	nThreadCount = 1;
+}
+
+INT32 BurnThreadCount()
+{
+	return nThreadCount;
+}
+
+void BurnThreadRun(void (*pJob)(INT32 nJob), INT32 nJobs)
+{
+	INT32 i;
+
+#if defined(HAVE_THREADS)
+	if (nThreadCount > 1 && nJobs > 1) {
+		pthread_mutex_lock(&ThreadMutex);
+		pThreadJob = pJob;
+		nJobCount = nJobs;
+		nJobNext = 1;
+		nJobsLeft = nJobs - 1;
+		nJobBatch++;
+		pthread_cond_broadcast(&ThreadWork);
+		pthread_mutex_unlock(&ThreadMutex);
+
+		pJob(0);
+
+		// Help out with anything not picked up yet, then wait for the rest
+		pthread_mutex_lock(&ThreadMutex);
+		BurnThreadTakeJobs();
+		while (nJobsLeft > 0)
+			pthread_cond_wait(&ThreadDone, &ThreadMutex);
+		pthread_mutex_unlock(&ThreadMutex);
+
+		return;
+	}
+#endif
+
+	for (i = 0; i < nJobs; i++)
+		pJob(i);
+}
+
+// Start pJob on the async thread (once the last one is done) and return
+void BurnThreadAsync(void (*pJob)())
+{
+	BurnThreadSync();
+
+#if defined(HAVE_THREADS)
+	if (!bAsyncStarted) {
+		bAsyncQuit = 0;
+		if (pthread_create(&AsyncId, NULL, BurnThreadAsyncMain, NULL) == 0)
+			bAsyncStarted = 1;
+	}
+
+	if (bAsyncStarted) {
+		pthread_mutex_lock(&AsyncMutex);
+		pAsyncJob = pJob;
+		pthread_cond_signal(&AsyncWork);
+		pthread_mutex_unlock(&AsyncMutex);
+
+		return;
+	}
+#endif
+
+	pJob();										// No thread, just run it now
+}
+
+// Wait for the job started by BurnThreadAsync() to finish
+void BurnThreadSync()
+{
+#if defined(HAVE_THREADS)
+	if (bAsyncStarted) {
+		pthread_mutex_lock(&AsyncMutex);
+		while (pAsyncJob != NULL)
+			pthread_cond_wait(&AsyncDone, &AsyncMutex);
+		pthread_mutex_unlock(&AsyncMutex);
+	}
+#endif
+}
@@ -11,6 +11,14 @@
 // Maximum number of beam-synchronized interrupts to check
 #define MAX_RASTER 10
 
+// Drawing state which each band of the screen needs its own copy of, when the
+// bands are drawn on several threads at once (see Cps2Layers)
+#if defined(HAVE_THREADS)
+ #define CPS_TLS __thread
+#else
+ #define CPS_TLS
+#endif
+
 extern UINT32 CpsMProt[4];									// Mprot changes
 extern UINT32 CpsBID[3];										// Board ID changes
 
@@ -176,6 +184,7 @@ extern UINT8 Cpi01A, Cpi01C, Cpi01E;
 extern INT32 nIrqLine50, nIrqLine52;								// The scanlines at which the interrupts are triggered
 extern INT32 nCpsNumScanlines;
 extern INT32 CpsDrawSpritesInReverse;
+extern INT32 Cps2Z80SyncLines;								// Also sync the QSound Z80 every this many lines, 0 = only on shared RAM access
 INT32 CpsRunInit();
 INT32 CpsRunExit();
 INT32 Cps2Frame();
@@ -264,7 +273,8 @@ extern CpsRWSoundCommandCallback CpsRWSoundCommandCallbackFunction;
 extern UINT8 CpsRecalcPal;				// Flag - If it is 1, recalc the whole palette
 extern INT32 nCpsLcReg;							// Address of layer controller register
 extern INT32 CpsLayEn[6];							// bits for layer enable
-extern INT32 nStartline, nEndline;				// specify the vertical slice of the screen to render
+extern CPS_TLS INT32 nStartline, nEndline;				// specify the vertical slice of the screen to render
+extern CPS_TLS INT32 nSliceEnd;					// End of the whole raster slice (nEndline can stop short at a band edge)
 extern INT32 nRasterline[MAX_RASTER + 2];			// The lines at which an interrupt occurs
 extern INT32 MaskAddr[4];
 extern INT32 CpsLayer1XOffs;
@@ -274,9 +284,30 @@ extern INT32 CpsLayer1YOffs;
 extern INT32 CpsLayer2YOffs;
 extern INT32 CpsLayer3YOffs;
 extern INT32 CpsDisableRowScroll;
+extern INT32 bCpsDrawThread;						// Draw on the render thread, one frame behind (set by the application)
+extern INT32 bCpsSkipSame;						// Don't redraw a frame if nothing in it has changed (set by the application)
+extern INT32 bCpsFrameSame;						// Set by CpsDraw if it skipped the frame: the last one drawn still stands
+extern UINT8 **CpsDrawReg, **CpsDrawFrg;			// What is drawn: CpsSaveReg/Frg, nRasterline, CpsPal and CpsRam90,
+extern INT32 *CpsDrawRasterline;					// or the snapshot of them taken for the render thread
+extern UINT32 *CpsDrawPal;
+extern UINT8 *CpsDrawRam90;
 void DrawFnInit();
+void DrawFnExit();
 INT32  CpsDraw();
 INT32  CpsRedraw();
+extern INT32 bCpsDrawLines;						// Draw lines as the raster reaches them (set by the application)
+void CpsDrawLinesBegin();
+void CpsDrawLinesSplit(INT32 nLine);
+void CpsDrawLinesEnd();
+
+// CpsFindGfxRam for the drawing code, which may be working from a snapshot
+static INLINE UINT8* CpsDrawFindGfxRam(INT32 nAddr,INT32 nLen)
+{
+  UINT8* Find = CpsFindGfxRam(nAddr, nLen);
+  if (Find)
+     return CpsDrawRam90 + (Find - CpsRam90);
+  return NULL;
+}
 
 #define BURN_SND_QSND_OUTPUT_1			0
 #define BURN_SND_QSND_OUTPUT_2			1
@@ -296,6 +327,8 @@ INT32 QsndZExit();
 INT32 QsndZScan(INT32 nAction);
 
 // qs_c.cpp
+extern INT32 bQscNativeRate;					// Mix at the chip's own rate, then resample (set by the application)
+extern INT32 bQscFrameSilent;					// Set if the frame's sound output was all silence
 INT32 QscInit(INT32 nRate);
 void QscSetRoute(INT32 nIndex, double nVolume, INT32 nRouteDir);
 void QscReset();
@@ -305,38 +338,70 @@ void QscNewFrame();
 void QscWrite(INT32 a, INT32 d);
 INT32 QscUpdate(INT32 nEnd);
 
-// cps_tile.cpp
-extern UINT32* CpstPal;
-extern UINT32 nCpstType; extern INT32 nCpstX,nCpstY;
-extern UINT32 nCpstTile; extern INT32 nCpstFlip;
-extern short* CpstRowShift;
-extern UINT32 CpstPmsk; // Pixel mask
+// cpst.cpp
+struct CpstCmd {
+	INT32 nX, nY;					// Screen position
+	UINT32 nTile;					// Tile address in CpsGfx
+	UINT32* pPal;					// 16 colours for the tile
+	INT16* pRows;					// Row shifts (CTT_ROWS)
+	UINT16 nZValue;					// Sprite z value (CTT_MASK)
+	UINT8 nType;					// CTT_* flags
+	UINT8 nFlip;					// Bit 0 = flip x, bit 1 = flip y
+};
 
-static INLINE void CpstSetPal(INT32 nPal)
+#define CPST_BATCH_SIZE (0x800)
+extern CPS_TLS struct CpstCmd CpstBatch[CPST_BATCH_SIZE];
+extern CPS_TLS INT32 nCpstBatchCount;
+extern UINT16 *ZBuf;
+extern UINT8 *ZBuf8;
+
+typedef void (*CtvDoFn)(struct CpstCmd*, INT32);
+
+void CpstBatchBegin(INT32 nClipStart, INT32 nClipEnd);
+void CpstBatchFlush();
+INT32 CtvReady();
+extern UINT8 *pCtvDraw;					// pBurnDraw and nBurnPitch, as they were when CtvReady() was called
+extern INT32 nCtvPitch;
+
+extern INT32 bCpstGfx8;
+extern UINT8 *CpsGfx8;
+extern UINT32 *CpstTileBlank[3];
+extern UINT32 *CpstTileOpaque[3];
+INT32 CpstCacheInit();
+void CpstCacheExit();
+
+// Test bit n of a tile flag set
+#define CPST_TILE_BIT(p, n) (((p)[(n) >> 5] >> ((n) & 31)) & 1)
+
+// Check if the tile at nTile (nType is CTT_8X8, CTT_16X16 or CTT_32X32) has
+// nothing to draw, either because it is blank or beyond the loaded graphics
+static INLINE INT32 CpstTileBlankTest(INT32 nType, UINT32 nTile)
+{
+	INT32 nShift = 6 + (nType >> 3);		// 6, 7 or 9
+	INT32 i = (nType >> 3) - (nType >> 4);	// 0, 1 or 2
+
+	nTile &= nCpsGfxMask;
+	if (nTile >= nCpsGfxLen)
+		return 1;
+
+	return CPST_TILE_BIT(CpstTileBlank[i], nTile >> nShift);
+}
+
+// Get the next free tile in the batch
+static INLINE struct CpstCmd* CpstBatchAdd()
+{
+	if (nCpstBatchCount >= CPST_BATCH_SIZE)
+		CpstBatchFlush();
+	return CpstBatch + nCpstBatchCount++;
+}
+
+static INLINE UINT32* CpstGetPal(INT32 nPal)
 {
 	nPal <<= 4;
 	nPal &= 0x7F0;
-	CpstPal= CpsPal + nPal;
+	return CpsDrawPal + nPal;
 }
 
-// ctv.cpp
-extern INT32 nBgHi;
-extern UINT16  ZValue;
-extern UINT16 *ZBuf;
-extern UINT16 *pZVal;
-extern UINT32    nCtvRollX,nCtvRollY;
-extern UINT8  *pCtvTile;					// Pointer to tile data
-extern INT32             nCtvTileAdd;					// Amount to add after each tile line
-extern UINT8  *pCtvLine;					// Pointer to output bitmap
-typedef INT32 (*CtvDoFn)();
-typedef INT32 (*CpstOneDoFn)();
-extern CtvDoFn CtvDoX[0x20];
-extern CtvDoFn CtvDoXM[0x20];
-extern CtvDoFn CtvDoXB[0x20];
-extern CpstOneDoFn CpstOneObjDoX[2];
-INT32 Cps2tOne();
-INT32 CtvReady();
-
 // nCpstType constants
 // To get size do (nCpstType & 24) + 8
 #define CTT_FLIPX ( 1)
@@ -345,6 +410,8 @@ INT32 CtvReady();
 #define CTT_8X8   ( 0)
 #define CTT_16X16 ( 8)
 #define CTT_32X32 (24)
+#define CTT_MASK  (32)				// CPS2 sprite masking against ZBuf
+#define CTT_ZBUF8 (64)				// With CTT_MASK, against ZBuf8 instead (16x16 only)
 
 // cps_obj.cpp
 extern INT32 nCpsObjectBank;
@@ -360,6 +427,12 @@ INT32 DaimakaibObjGet();
 INT32 WofhObjGet();
 INT32 Sf2mdtObjGet();
 void CpsObjDrawInit();
+void CpsObjDrawBand(INT32 nBandStart, INT32 nBandEnd);
+void CpsObjDrawExit();
+void CpsObjDrawSnapshot(INT32 bCopy);
+void CpsObjDrawLatest();
+INT32 CpsObjDrawSame();
+void CpsObjDrawRemember();
 INT32  Cps2ObjDraw(INT32 nLevelFrom,INT32 nLevelTo);
 INT32  FcrashObjDraw(INT32 nLevelFrom,INT32 nLevelTo);
 
@@ -374,10 +447,10 @@ extern INT32 Scroll2TileMask;
 extern INT32 Scroll3TileMask;
 
 // cpsr.cpp
-extern UINT8 *CpsrBase;						// Tile data base
-extern INT32 nCpsrScrX,nCpsrScrY;						// Basic scroll info
-extern UINT16 *CpsrRows;					// Row scroll table, 0x400 words long
-extern INT32 nCpsrRowStart;							// Start of row scroll (can wrap?)
+extern CPS_TLS UINT8 *CpsrBase;						// Tile data base
+extern CPS_TLS INT32 nCpsrScrX,nCpsrScrY;						// Basic scroll info
+extern CPS_TLS UINT16 *CpsrRows;					// Row scroll table, 0x400 words long
+extern CPS_TLS INT32 nCpsrRowStart;							// Start of row scroll (can wrap?)
 
 // Information needed to draw a line
 struct CpsrLineInfo {
@@ -389,7 +462,7 @@ struct CpsrLineInfo {
 	INT16 Rows[16];									// 16 row scroll values for this line
 	INT32 nMaxLeft, nMaxRight;						// Maximum row shifts left and right
 };
-extern struct CpsrLineInfo CpsrLineInfo[15];
+extern CPS_TLS struct CpsrLineInfo CpsrLineInfo[15];
 INT32 Cps2rPrepare();
 
 // cpsrd.cpp
@@ -462,5 +535,7 @@ INT32 Sf2mdtScanSound(INT32 nAction, INT32 *pnMin);
 extern INT32 Cps2Volume;
 extern UINT16 Cps2VolumeStates[40];
 extern INT32 Cps2DisableDigitalVolume;
+extern INT32 Cps2IdleSkip;
+extern INT32 Cps2ZIdleSkip;
 extern UINT8 Cps2VolUp;
 extern UINT8 Cps2VolDwn;
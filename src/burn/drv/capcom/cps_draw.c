@@ -5,9 +5,64 @@
 UINT8 CpsRecalcPal = 0;			// Flag - If it is 1, recalc the whole palette
 
 static INT32 LayerCont;
-INT32 nStartline, nEndline;
+CPS_TLS INT32 nStartline, nEndline;
+CPS_TLS INT32 nSliceEnd;
 INT32 nRasterline[MAX_RASTER + 2];
 
+// Layer order for each raster slice, worked out once per frame by Cps2Layers
+static INT32 Draw[MAX_RASTER][4];
+static INT32 Prio[MAX_RASTER][4];
+static INT32 nDrawMask[MAX_RASTER];
+
+// Screen bands, drawn in parallel when there are worker threads
+static INT32 nCpsBandLine[BURN_THREAD_MAX + 1];
+
+INT32 bCpsDrawThread = 0;					// Draw on the render thread, one frame behind
+
+// What the drawing code reads: the live state, or a snapshot for the render thread
+UINT8 **CpsDrawReg = CpsSaveReg;
+UINT8 **CpsDrawFrg = CpsSaveFrg;
+INT32 *CpsDrawRasterline = nRasterline;
+UINT32 *CpsDrawPal = NULL;
+UINT8 *CpsDrawRam90 = NULL;
+static INT32 nDrawLayer;
+
+// Line by line drawing: the registers of the lines not drawn yet
+INT32 bCpsDrawLines = 0;
+static INT32 bLinesActive = 0;
+static INT32 nLineStart;					// First line not drawn yet
+static UINT8 LineReg[0x100], LineFrg[0x10];
+static UINT8 *LineRegPtr[2], *LineFrgPtr[2];
+static INT32 nLineRaster[MAX_RASTER + 2];
+
+// Everything the drawing code reads which the 68000 can change in the next frame
+struct CpsDrawPacket {
+	INT32 nRasterline[MAX_RASTER + 2];
+	UINT8 Reg[MAX_RASTER + 1][0x100];
+	UINT8 Frg[MAX_RASTER + 1][0x10];
+	UINT8 *RegPtr[MAX_RASTER + 1];
+	UINT8 *FrgPtr[MAX_RASTER + 1];
+	UINT32 Pal[0xc00];
+	UINT8 Ram90[0x30000];					// Only the parts the tile maps are in get copied
+};
+
+static struct CpsDrawPacket *pPacket = NULL;
+
+// Skipping unchanged frames: what the last frame drawn was drawn from
+INT32 bCpsSkipSame = 0;
+INT32 bCpsFrameSame = 0;
+static struct CpsDrawPacket *pLast = NULL;
+static INT32 bLastValid = 0;
+static INT32 nLastLayer;
+
+// Graphics RAM used by each raster slice (see DrawScroll1, DrawScroll2Init and DrawScroll3)
+static const struct { INT32 nReg, nMask, nLen; } GfxRamUsed[4] = {
+	{ 0x02, 0xffc000, 0x4000 },				// Scroll 1
+	{ 0x04, 0xffc000, 0x4000 },				// Scroll 2
+	{ 0x08, 0xfff800, 0x0800 },				// Scroll 2 row scroll table
+	{ 0x06, 0xffc000, 0x4000 },				// Scroll 3
+};
+
 INT32 nCpsLcReg = 0;						// Address of layer controller register
 INT32 CpsLayEn[6] = {0, 0, 0, 0, 0, 0};	// bits for layer enable
 INT32 MaskAddr[4] = {0, 0, 0, 0};
@@ -36,12 +91,28 @@ void DrawFnInit(void)
 {
 }
 
+void DrawFnExit(void)
+{
+	BurnThreadSync();						// Let the render thread finish with the packet
+
+	BurnFree(pPacket);
+	BurnFree(pLast);
+	bLastValid = 0;
+	bCpsFrameSame = 0;
+	bLinesActive = 0;
+
+	CpsDrawReg = CpsSaveReg;
+	CpsDrawFrg = CpsSaveFrg;
+	CpsDrawRasterline = nRasterline;
+	CpsDrawPal = NULL;
+	CpsDrawRam90 = NULL;
+}
+
 static INT32 Cps2Scr1Draw(UINT8 *Base, INT32 sx, INT32 sy)
 {
 	INT32 x, y;
 	INT32 iy;
 	INT32 nFirstY, nLastY;
-	INT32 nKnowBlank = -1; // The tile we know is blank
 	INT32 ix = (sx >> 3) + 1;
 	sx &= 7;
 	sx = 8 - sx;
@@ -54,11 +125,15 @@ static INT32 Cps2Scr1Draw(UINT8 *Base, INT32 sx, INT32 sy)
 
 	sy = 8 - sy;
 
+	CpstBatchBegin(nStartline, nEndline);
+
 	for (y = nFirstY - 1; y < nLastY; y++)
    {
-      INT32 nClipY = ((y << 3) < nStartline) | (((y << 3) + 8) >= nEndline);
+      INT32 nTileY = sy + (y << 3);
+      INT32 nClipY = (nTileY < nStartline) | ((nTileY + 8) > nEndline);
       for (x = -1; x < 48; x++)
       {
+         struct CpstCmd *pCmd;
          INT32 a;
          INT32 fx = ix + x;
          INT32 fy = iy + y;								// 0 <= fx/fy <= 63
@@ -70,29 +145,28 @@ static INT32 Cps2Scr1Draw(UINT8 *Base, INT32 sx, INT32 sy)
 
          t += nCpsGfxScroll[1];							// add on offset to scroll tiles
 
-         /* Draw tile */
-         if (t == nKnowBlank)
-            continue;
+         if (CpstTileBlankTest(CTT_8X8, t))
+            continue;									// Don't draw: it's blank
 
          a = BURN_ENDIAN_SWAP_INT16(pst[1]);
 
-         CpstSetPal(0x20 | (a & 0x1F));
-
-         nCpstX    = sx + (x << 3);
-         nCpstY    = sy + (y << 3);
-         nCpstTile = t;
-         nCpstFlip = (a >> 5) & 3;
+         /* Queue tile */
+         pCmd = CpstBatchAdd();
+         pCmd->pPal  = CpstGetPal(0x20 | (a & 0x1F));
+         pCmd->nX    = sx + (x << 3);
+         pCmd->nY    = sy + (y << 3);
+         pCmd->nTile = t;
+         pCmd->nFlip = (a >> 5) & 3;
 
-         nCpstType = CTT_8X8;
+         pCmd->nType = CTT_8X8;
 
          // Don't need to clip except around the border
          if (x < 0 || x >= 48 - 1 || nClipY)
-            nCpstType |= CTT_CARE;
-
-         if (Cps2tOne())
-            nKnowBlank = t;
+            pCmd->nType |= CTT_CARE;
       }
    }
+
+	CpstBatchFlush();
 	return 0;
 }
 
@@ -100,11 +174,11 @@ static INT32 DrawScroll1(INT32 i)
 {
    // Draw Scroll 1
    UINT8 *Find;
-   INT32 nOff = BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsSaveReg[i] + 0x02)));
+   INT32 nOff = BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsDrawReg[i] + 0x02)));
 
    // Get scroll coordinates
-   INT32 nScrX = BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsSaveReg[i] + 0x0c))); // Scroll 1 X
-   INT32 nScrY = BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsSaveReg[i] + 0x0e))); // Scroll 1 Y
+   INT32 nScrX = BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsDrawReg[i] + 0x0c))); // Scroll 1 X
+   INT32 nScrY = BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsDrawReg[i] + 0x0e))); // Scroll 1 Y
 
    nScrX += 0x40;
 
@@ -113,7 +187,7 @@ static INT32 DrawScroll1(INT32 i)
    nScrY += CpsLayer1YOffs;
    nOff <<= 8;
    nOff &= 0xffc000;
-   Find = CpsFindGfxRam(nOff, 0x4000);
+   Find = CpsDrawFindGfxRam(nOff, 0x4000);
    if (Find == NULL)
       return 1;
    Cps2Scr1Draw(Find, nScrX, nScrY);
@@ -124,14 +198,14 @@ static INT32 DrawScroll2Init(INT32 i)
 {
    // Draw Scroll 2
    INT32 n;
-   INT32 nScr2Off = BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsSaveReg[i] + 0x04)));
+   INT32 nScr2Off = BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsDrawReg[i] + 0x04)));
 
    // Get scroll coordinates
-   nCpsrScrX= BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsSaveReg[i] + 0x10))); // Scroll 2 X
-   nCpsrScrY= BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsSaveReg[i] + 0x12))); // Scroll 2 Ytess
+   nCpsrScrX= BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsDrawReg[i] + 0x10))); // Scroll 2 X
+   nCpsrScrY= BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsDrawReg[i] + 0x12))); // Scroll 2 Ytess
 
    // Get row scroll information
-   n = BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsSaveReg[i] + 0x22)));
+   n = BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsDrawReg[i] + 0x22)));
 
    nScr2Off <<= 8;
 
@@ -145,7 +219,7 @@ static INT32 DrawScroll2Init(INT32 i)
    nCpsrScrY &= 0x03FF;
 
    nScr2Off &= 0xFFC000;
-   CpsrBase = CpsFindGfxRam(nScr2Off, 0x4000);
+   CpsrBase = CpsDrawFindGfxRam(nScr2Off, 0x4000);
    if (CpsrBase == NULL) {
       return 1;
    }
@@ -155,13 +229,13 @@ static INT32 DrawScroll2Init(INT32 i)
    if ((n & 1) && !CpsDisableRowScroll)
    {
       // Find row scroll table:
-      INT32 nTab = BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsSaveReg[i] + 0x08)));
-      INT32 nStart = BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsSaveReg[i] + 0x20)));
+      INT32 nTab = BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsDrawReg[i] + 0x08)));
+      INT32 nStart = BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsDrawReg[i] + 0x20)));
 
       nTab <<= 8;
       nTab &= 0xFFF800; // Vampire - Row scroll effect in VS screen background
 
-      CpsrRows = (UINT16 *)CpsFindGfxRam(nTab, 0x0800);
+      CpsrRows = (UINT16 *)CpsDrawFindGfxRam(nTab, 0x0800);
 
       // Find start offset
       nCpsrRowStart = nStart + 16;
@@ -193,7 +267,6 @@ static INT32 Cps2Scr3Draw(UINT8 *Base, INT32 sx, INT32 sy)
 	INT32 x, y;
 	INT32 iy;
 	INT32 nFirstY, nLastY;
-	INT32 nKnowBlank = -1; // The tile we know is blank
 	INT32 ix = (sx >> 5) + 1;
 	sx &= 31;
 	sx = 32 - sx;
@@ -206,11 +279,15 @@ static INT32 Cps2Scr3Draw(UINT8 *Base, INT32 sx, INT32 sy)
 
 	sy = 32 - sy;
 
+	CpstBatchBegin(nStartline, nEndline);
+
 	for (y = nFirstY - 1; y < nLastY; y++)
    {
-      INT32 nClipY = ((y << 5) < nStartline) | (((y << 5) + 32) >= nEndline);
+      INT32 nTileY = sy + (y << 5);
+      INT32 nClipY = (nTileY < nStartline) | ((nTileY + 32) > nEndline);
       for (x = -1; x < 12; x++)
       {
+         struct CpstCmd *pCmd;
          INT32 t, a;
          UINT16 *pst;
          INT32 fx, fy, p;
@@ -229,29 +306,28 @@ static INT32 Cps2Scr3Draw(UINT8 *Base, INT32 sx, INT32 sy)
          t <<= 9;										// Get real tile address
          t += nCpsGfxScroll[3];							// add on offset to scroll tiles
 
-         if (t == nKnowBlank) 
-            continue;
+         if (CpstTileBlankTest(CTT_32X32, t))
+            continue;									// Don't draw: it's blank
 
-         /* Draw tile */
+         /* Queue tile */
 
          a = BURN_ENDIAN_SWAP_INT16(pst[1]);
 
-         CpstSetPal(0x60 | (a & 0x1F));
-
-         nCpstX    = sx + (x << 5);
-         nCpstY    = sy + (y << 5);
-         nCpstTile = t;
-         nCpstFlip = (a >> 5) & 3;
-         nCpstType = CTT_32X32;
+         pCmd = CpstBatchAdd();
+         pCmd->pPal  = CpstGetPal(0x60 | (a & 0x1F));
+         pCmd->nX    = sx + (x << 5);
+         pCmd->nY    = sy + (y << 5);
+         pCmd->nTile = t;
+         pCmd->nFlip = (a >> 5) & 3;
+         pCmd->nType = CTT_32X32;
 
          // Don't need to clip except around the border
          if (x < 0 || x >= 12 - 1 || nClipY)
-            nCpstType |= CTT_CARE;
-
-         if (Cps2tOne())
-            nKnowBlank = t;
+            pCmd->nType |= CTT_CARE;
       }
    }
+
+	CpstBatchFlush();
 	return 0;
 }
 
@@ -260,11 +336,11 @@ static INT32 DrawScroll3(INT32 i)
    // Draw Scroll 3
    UINT8 *Find;
 
-   INT32 nOff = BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsSaveReg[i] + 0x06)));
+   INT32 nOff = BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsDrawReg[i] + 0x06)));
 
    // Get scroll coordinates
-   INT32 nScrX = BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsSaveReg[i] + 0x14))); // Scroll 3 X
-   INT32 nScrY = BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsSaveReg[i] + 0x16))); // Scroll 3 Y
+   INT32 nScrX = BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsDrawReg[i] + 0x14))); // Scroll 3 X
+   INT32 nScrY = BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsDrawReg[i] + 0x16))); // Scroll 3 Y
 
    nScrX += 0x40;
 
@@ -274,7 +350,7 @@ static INT32 DrawScroll3(INT32 i)
 
    nOff <<= 8;
    nOff &= 0xffc000;
-   Find=CpsFindGfxRam(nOff, 0x4000);
+   Find=CpsDrawFindGfxRam(nOff, 0x4000);
 
    if (!Find)
       return 1;
@@ -296,29 +372,96 @@ static INT32 DrawStar(INT32 nLayer)
       if (nStarColour == 0x0F)
          continue;
 
-      nStarXPos = (((i >> 8) << 5) - *((INT16*)(CpsSaveReg[0] + 0x18 + (nLayer << 2))) + (nStarColour & 0x1F) - 64) & 0x01FF;
-      nStarYPos = ((i & 0xFF) - *((INT16*)(CpsSaveReg[0] + 0x1A + (nLayer << 2))) - 16) & 0xFF;
+      nStarXPos = (((i >> 8) << 5) - *((INT16*)(CpsDrawReg[0] + 0x18 + (nLayer << 2))) + (nStarColour & 0x1F) - 64) & 0x01FF;
+      nStarYPos = ((i & 0xFF) - *((INT16*)(CpsDrawReg[0] + 0x1A + (nLayer << 2))) - 16) & 0xFF;
 
       if (nStarXPos < 384 && nStarYPos < 224)
       {
          nStarColour = ((nStarColour & 0xE0) >> 1) + ((GetCurrentFrame() >> 4) & 0x0F);
-         PutPix(pBurnDraw + (nBurnPitch * nStarYPos) + (nBurnBpp * nStarXPos), CpsPal[0x0800 + (nLayer << 9) + nStarColour]);
+         PutPix(pCtvDraw + (nCtvPitch * nStarYPos) + (nBurnBpp * nStarXPos), CpsDrawPal[0x0800 + (nLayer << 9) + nStarColour]);
       }
    }
 
    return 0;
 }
 
-static void Cps2Layers(void)
+// Draw lines nCpsBandLine[nBand] to nCpsBandLine[nBand + 1] - 1 of every layer.
+// Each pixel is drawn in the same order as when drawing the whole screen at once.
+static void Cps2LayersBand(INT32 nBand)
 {
-   INT32 Draw[MAX_RASTER][4];
-   INT32 Prio[MAX_RASTER][4];
-   INT32 nDrawMask[MAX_RASTER];
+   INT32 nBandStart = nCpsBandLine[nBand];
+   INT32 nBandEnd = nCpsBandLine[nBand + 1];
    INT32 nCurrPrio;
-   INT32 nSlice = 0;
+   INT32 nSlice;
    INT32 nPrevPrio = -1;
 
-   CpsObjDrawInit();
+   CpsObjDrawBand(nBandStart, nBandEnd);
+
+   for (nCurrPrio = 0; nCurrPrio < 8; nCurrPrio++)
+   {
+      nSlice = 0;
+      do
+      {
+         INT32 i;
+         for (i = 0; i < 4; i++)
+         {
+            if (Prio[nSlice][Draw[nSlice][i]] == nCurrPrio)
+            {
+               // Render sprites between the previous layer and this one
+               if ((nDrawMask[0] & 1) && (nPrevPrio < nCurrPrio))
+               {
+                  Cps2ObjDraw(nPrevPrio + 1, nCurrPrio);
+                  nPrevPrio = nCurrPrio;
+               }
+
+               nStartline = CpsDrawRasterline[nSlice];
+               nEndline = CpsDrawRasterline[nSlice + 1];
+               if (!nEndline)
+                  nEndline = 224;
+               nSliceEnd = nEndline;
+
+               // Only the part of the slice inside this band
+               if (nStartline < nBandStart)
+                  nStartline = nBandStart;
+               if (nEndline > nBandEnd)
+                  nEndline = nBandEnd;
+               if (nStartline >= nEndline)
+                  continue;
+
+               // Render layer
+               switch (Draw[nSlice][i])
+               {
+                  case 1:
+                     if (nDrawMask[nSlice] & 2)
+                        DrawScroll1(nSlice);
+                     break;
+                  case 2:
+                     if (nDrawMask[nSlice] & 4) {
+                        DrawScroll2Init(nSlice);
+                        DrawScroll2Do();
+                        DrawScroll2Exit();
+                     }
+                     break;
+                  case 3:
+                     if (nDrawMask[nSlice] & 8)
+                        DrawScroll3(nSlice);
+                     break;
+               }
+            }
+         }
+         nSlice++;
+      }  while (nSlice < MAX_RASTER && CpsDrawRasterline[nSlice]);
+   }
+
+   // Render highest priority sprites
+   if ((nDrawMask[0] & 1) && (nPrevPrio < 7))
+      Cps2ObjDraw(nPrevPrio + 1, 7);
+}
+
+// Work out the layer order for each raster slice
+static void Cps2LayersPrepare(void)
+{
+   INT32 nSlice = 0;
 
    do
    {
@@ -326,14 +469,14 @@ static void Cps2Layers(void)
       INT32 nLayPri;
       INT32 nHighPrio;
 
-      LayerCont = BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsSaveReg[nSlice] + nCpsLcReg)));
+      LayerCont = BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsDrawReg[nSlice] + nCpsLcReg)));
 
       // Determine which layers are enabled
       nDrawMask[nSlice] = 1;								// Sprites always on
       if (LayerCont & CpsLayEn[1]) nDrawMask[nSlice] |= 2;
       if (LayerCont & CpsLayEn[2]) nDrawMask[nSlice] |= 4;
       if (LayerCont & CpsLayEn[3]) nDrawMask[nSlice] |= 8;
-      nDrawMask[nSlice] &= nBurnLayer;					// User choice of layers to display
+      nDrawMask[nSlice] &= nDrawLayer;					// User choice of layers to display
 
       // Determine layer priority:
       Draw[nSlice][3] = (LayerCont >> 12) & 3;			// top layer
@@ -342,7 +485,7 @@ static void Cps2Layers(void)
       Draw[nSlice][0] = (LayerCont >> 6) & 3;				// bottom layer (most covered up)
 
       // Determine layer-sprite priority (layer >= sprites -> layer on top)
-      nLayPri = (CpsSaveFrg[nSlice][4] << 8) | CpsSaveFrg[nSlice][5];	// Layer priority register at word (400004)
+      nLayPri = (CpsDrawFrg[nSlice][4] << 8) | CpsDrawFrg[nSlice][5];	// Layer priority register at word (400004)
       Prio[nSlice][3] = (nLayPri >> 12) & 7;
       Prio[nSlice][2] = (nLayPri >> 8) & 7;
       Prio[nSlice][1] = (nLayPri >> 4) & 7;
@@ -369,58 +512,32 @@ static void Cps2Layers(void)
          }
       }
       nSlice++;
-   } while (nSlice < MAX_RASTER && nRasterline[nSlice]);
+   } while (nSlice < MAX_RASTER && CpsDrawRasterline[nSlice]);
+}
 
-   for (nCurrPrio = 0; nCurrPrio < 8; nCurrPrio++)
-   {
-      nSlice = 0;
-      do
-      {
-         INT32 i;
-         for (i = 0; i < 4; i++)
-         {
-            if (Prio[nSlice][Draw[nSlice][i]] == nCurrPrio)
-            {
-               // Render sprites between the previous layer and this one
-               if ((nDrawMask[0] & 1) && (nPrevPrio < nCurrPrio))
-               {
-                  Cps2ObjDraw(nPrevPrio + 1, nCurrPrio);
-                  nPrevPrio = nCurrPrio;
-               }
+// Draw lines nStart to nEnd - 1, split into one band per thread
+static void Cps2LayersDraw(INT32 nStart, INT32 nEnd)
+{
+   INT32 nBands = BurnThreadCount();
+   INT32 nBand;
 
-               nStartline = nRasterline[nSlice];
-               nEndline = nRasterline[nSlice + 1];
-               if (!nEndline)
-                  nEndline = 224;
+   if (nBands > nEnd - nStart)
+      nBands = nEnd - nStart;
 
-               // Render layer
-               switch (Draw[nSlice][i])
-               {
-                  case 1:
-                     if (nDrawMask[nSlice] & 2)
-                        DrawScroll1(nSlice);
-                     break;
-                  case 2:
-                     if (nDrawMask[nSlice] & 4) {
-                        DrawScroll2Init(nSlice);
-                        DrawScroll2Do();
-                        DrawScroll2Exit();
-                     }
-                     break;
-                  case 3:
-                     if (nDrawMask[nSlice] & 8)
-                        DrawScroll3(nSlice);
-                     break;
-               }
-            }
-         }
-         nSlice++;
-      }  while (nSlice < MAX_RASTER && nRasterline[nSlice]);
-   }
+   for (nBand = 0; nBand <= nBands; nBand++)
+      nCpsBandLine[nBand] = nStart + (nEnd - nStart) * nBand / nBands;
 
-   // Render highest priority sprites
-   if ((nDrawMask[0] & 1) && (nPrevPrio < 7))
-      Cps2ObjDraw(nPrevPrio + 1, 7);
+   BurnThreadRun(Cps2LayersBand, nBands);
+}
+
+static void Cps2Layers(void)
+{
+   CpsObjDrawInit();
+
+   Cps2LayersPrepare();
+   Cps2LayersDraw(0, 224);
+
+   CpsObjDrawExit();
 }
 
 void CpsClearScreen(void)
@@ -428,23 +545,187 @@ void CpsClearScreen(void)
    memset(pBurnDraw, 0, 384 * 224 * nBurnBpp);
 }
 
-static void DoDraw(INT32 Recalc)
+// Mark the 0x800 byte blocks of CpsRam90 the tile maps and row scroll tables
+// of the raster slices are in, and return the number of slices
+static INT32 CpsDrawGfxRamUsed(UINT8 *bUsed)
+{
+	INT32 nSlice = 0;
+	INT32 i;
+
+	memset(bUsed, 0, 0x30000 >> 11);
+	do
+	{
+		for (i = 0; i < 4; i++)
+		{
+			INT32 nAddr = (BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsSaveReg[nSlice] + GfxRamUsed[i].nReg))) << 8) & GfxRamUsed[i].nMask;
+			UINT8 *Find = CpsFindGfxRam(nAddr, GfxRamUsed[i].nLen);
+			INT32 nOff;
+
+			if (Find == NULL)
+				continue;
+
+			for (nOff = Find - CpsRam90; nOff < Find - CpsRam90 + GfxRamUsed[i].nLen; nOff += 0x800)
+				bUsed[nOff >> 11] = 1;
+		}
+		nSlice++;
+	} while (nSlice < MAX_RASTER && nRasterline[nSlice]);
+
+	return nSlice;
+}
+
+// Check if the frame would come out the same as the last one drawn, and if
+// not, remember what it is drawn from for next time
+static INT32 CpsDrawSame(void)
+{
+	UINT8 bUsed[0x30000 >> 11];
+	INT32 nSlices, bSame;
+	INT32 i;
+
+	if (pLast == NULL) {
+		pLast = (struct CpsDrawPacket*)BurnMalloc(sizeof(struct CpsDrawPacket));
+		if (pLast == NULL)
+			return 0;
+		bLastValid = 0;
+	}
+
+	nSlices = CpsDrawGfxRamUsed(bUsed);
+
+	// Cheapest first
+	bSame = bLastValid && nLastLayer == nDrawLayer && memcmp(pLast->nRasterline, nRasterline, sizeof(nRasterline)) == 0;
+	for (i = 0; bSame && i < nSlices; i++)
+		bSame = memcmp(pLast->Reg[i], CpsSaveReg[i], 0x100) == 0 && memcmp(pLast->Frg[i], CpsSaveFrg[i], 0x10) == 0;
+	if (bSame)
+		bSame = memcmp(pLast->Pal, CpsPal, sizeof(pLast->Pal)) == 0 && CpsObjDrawSame();
+	for (i = 0; bSame && i < (0x30000 >> 11); i++)
+		if (bUsed[i])
+			bSame = memcmp(pLast->Ram90 + (i << 11), CpsRam90 + (i << 11), 0x800) == 0;
+
+	if (bSame)
+		return 1;
+
+	memcpy(pLast->nRasterline, nRasterline, sizeof(nRasterline));
+	for (i = 0; i < nSlices; i++) {
+		memcpy(pLast->Reg[i], CpsSaveReg[i], 0x100);
+		memcpy(pLast->Frg[i], CpsSaveFrg[i], 0x10);
+	}
+	memcpy(pLast->Pal, CpsPal, sizeof(pLast->Pal));
+	for (i = 0; i < (0x30000 >> 11); i++)
+		if (bUsed[i])
+			memcpy(pLast->Ram90 + (i << 11), CpsRam90 + (i << 11), 0x800);
+	CpsObjDrawRemember();
+	nLastLayer = nDrawLayer;
+	bLastValid = 1;
+
+	return 0;
+}
+
+// Copy everything the drawing code reads into the packet, and point it there
+static INT32 CpsDrawSnapshot(void)
+{
+	UINT8 bUsed[0x30000 >> 11];
+	INT32 i;
+
+	if (pPacket == NULL) {
+		pPacket = (struct CpsDrawPacket*)BurnMalloc(sizeof(struct CpsDrawPacket));
+		if (pPacket == NULL)
+			return 1;
+
+		for (i = 0; i < MAX_RASTER + 1; i++) {
+			pPacket->RegPtr[i] = pPacket->Reg[i];
+			pPacket->FrgPtr[i] = pPacket->Frg[i];
+		}
+	}
+
+	memcpy(pPacket->nRasterline, nRasterline, sizeof(nRasterline));
+	for (i = 0; i < MAX_RASTER + 1; i++) {
+		memcpy(pPacket->Reg[i], CpsSaveReg[i], 0x100);
+		memcpy(pPacket->Frg[i], CpsSaveFrg[i], 0x10);
+	}
+	memcpy(pPacket->Pal, CpsPal, sizeof(pPacket->Pal));
+
+	// Only the tile maps and row scroll tables the raster slices point at
+	CpsDrawGfxRamUsed(bUsed);
+	for (i = 0; i < (0x30000 >> 11); i++)
+		if (bUsed[i])
+			memcpy(pPacket->Ram90 + (i << 11), CpsRam90 + (i << 11), 0x800);
+
+	CpsDrawReg = pPacket->RegPtr;
+	CpsDrawFrg = pPacket->FrgPtr;
+	CpsDrawRasterline = pPacket->nRasterline;
+	CpsDrawPal = pPacket->Pal;
+	CpsDrawRam90 = pPacket->Ram90;
+
+	CpsObjDrawSnapshot(1);
+
+	return 0;
+}
+
+static void CpsDrawFrame(void)
+{
+	memset(pCtvDraw, 0, 384 * 224 * nBurnBpp);
+
+	Cps2Layers();
+}
+
+// The same on the render thread, timed there as the main thread only starts it
+static void CpsDrawFrameThread(void)
+{
+	UINT64 (__cdecl *pClock)(void) = BurnExtProfileClockCallback;
+	UINT64 nStart = 0;
+
+	if (pClock)
+		nStart = pClock();
+
+	CpsDrawFrame();
+
+	if (pClock)
+		BurnProfAdd(BURN_PROF_DRAW_THREAD, pClock() - nStart);
+}
+
+static void DoDraw(INT32 Recalc, INT32 bThread, INT32 bSkipSame)
 {
+	BurnThreadSync();						// Wait for the last frame to be finished
+
 	CtvReady();								// Point to correct tile drawing functions
 
 	if (bCpsUpdatePalEveryFrame)
       GetPalette(0, 6);
 	if (Recalc || bCpsUpdatePalEveryFrame)
       CpsPalUpdate(CpsSavePal);		// recalc whole palette if needed
-	
-   memset(pBurnDraw, 0, 384 * 224 * nBurnBpp);
 
-	Cps2Layers();
+	nDrawLayer = nBurnLayer;
+
+	// Leave the last frame drawn if this one would come out the same
+	bCpsFrameSame = 0;
+	if (bSkipSame) {
+		if (CpsDrawSame()) {
+			bCpsFrameSame = 1;
+			return;
+		}
+	} else {
+		bLastValid = 0;
+	}
+
+	// Draw on the render thread while the next frame is emulated
+	if (bThread && CpsDrawSnapshot() == 0) {
+		BurnThreadAsync(CpsDrawFrameThread);
+		return;
+	}
+
+	CpsDrawReg = CpsSaveReg;
+	CpsDrawFrg = CpsSaveFrg;
+	CpsDrawRasterline = nRasterline;
+	CpsDrawPal = CpsPal;
+	CpsDrawRam90 = CpsRam90;
+
+	CpsObjDrawSnapshot(0);
+
+	CpsDrawFrame();
 }
 
 INT32 CpsDraw(void)
 {
-	DoDraw(CpsRecalcPal);
+	DoDraw(CpsRecalcPal, bCpsDrawThread, bCpsSkipSame);
 
 	CpsRecalcPal = 0;
 	return 0;
@@ -452,9 +733,97 @@ INT32 CpsDraw(void)
 
 INT32 CpsRedraw(void)
 {
-	DoDraw(1);
+	DoDraw(1, 0, 0);
 
 	CpsRecalcPal = 0;
 	return 0;
 }
 
+// Line by line drawing: instead of drawing the frame from the raster slices at
+// the end, Cps2Frame() runs the 68000 a line at a time and calls
+// CpsDrawLinesSplit() at each line. Each run of lines with the same registers
+// is drawn as soon as the registers change, so there is no limit on the number
+// of raster splits, and the drawing is spread over the frame.
+
+void CpsDrawLinesBegin(void)
+{
+	BurnThreadSync();						// Any frame still being drawn by the render thread
+
+	CtvReady();
+
+	if (bCpsUpdatePalEveryFrame)
+      GetPalette(0, 6);
+	if (CpsRecalcPal || bCpsUpdatePalEveryFrame)
+      CpsPalUpdate(CpsSavePal);
+	CpsRecalcPal = 0;
+
+	nDrawLayer = nBurnLayer;
+
+	bCpsFrameSame = 0;
+	bLastValid = 0;
+
+	// Every run is drawn as a single slice
+	LineRegPtr[0] = LineRegPtr[1] = LineReg;
+	LineFrgPtr[0] = LineFrgPtr[1] = LineFrg;
+	CpsDrawReg = LineRegPtr;
+	CpsDrawFrg = LineFrgPtr;
+	CpsDrawRasterline = nLineRaster;
+	CpsDrawPal = CpsPal;
+	CpsDrawRam90 = CpsRam90;
+
+	CpsObjDrawLatest();
+	CpsObjDrawInit();
+
+	memset(pCtvDraw, 0, 384 * 224 * nBurnBpp);
+
+	memcpy(LineReg, CpsReg, 0x100);
+	memcpy(LineFrg, CpsFrg, 0x10);
+	nLineStart = 0;
+	bLinesActive = 1;
+}
+
+// Draw the lines not drawn yet, up to nEnd - 1
+static void CpsDrawLinesRun(INT32 nEnd)
+{
+	if (nEnd > 224)
+		nEnd = 224;
+	if (nEnd <= nLineStart)
+		return;
+
+	memset(nLineRaster, 0, sizeof(nLineRaster));
+	nLineRaster[0] = nLineStart;
+	if (nEnd < 224)
+		nLineRaster[1] = nEnd;				// So the row scroll stops at the end of the run
+
+	BURN_PROF_ENTER(BURN_PROF_DRAW);
+	Cps2LayersPrepare();
+	Cps2LayersDraw(nLineStart, nEnd);
+	CpsObjDrawExit();
+	BURN_PROF_LEAVE();
+
+	nLineStart = nEnd;
+}
+
+// The registers as they are now apply from line nLine on
+void CpsDrawLinesSplit(INT32 nLine)
+{
+	if (!bLinesActive)
+		return;
+
+	if (memcmp(LineReg, CpsReg, 0x100) == 0 && memcmp(LineFrg, CpsFrg, 0x10) == 0)
+		return;
+
+	CpsDrawLinesRun(nLine);
+
+	memcpy(LineReg, CpsReg, 0x100);
+	memcpy(LineFrg, CpsFrg, 0x10);
+}
+
+void CpsDrawLinesEnd(void)
+{
+	if (!bLinesActive)
+		return;
+
+	CpsDrawLinesRun(224);
+	bLinesActive = 0;
+}
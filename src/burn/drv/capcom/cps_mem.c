@@ -41,6 +41,7 @@ static INT32 CpsMemIndex(void)
    CpsFrg    = Next; Next += 0x000010;							// 'Four' Registers (Registers at 0x400000)
 
    ZBuf      = (UINT16*)Next; Next += 384 * 224 * 2;	// Sprite Masking Z buffer
+   ZBuf8     = Next; Next += 384 * 224;				// Sprite Masking Z buffer, for lists under 255 sprites
 
    CpsSaveRegData = Next; Next += 0x0100 * (MAX_RASTER + 1);	// Draw Copy of registers
    CpsSaveFrgData = Next; Next += 0x0010 * (MAX_RASTER + 1);	// Draw Copy of 'Four' Registers
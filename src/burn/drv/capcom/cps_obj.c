@@ -11,43 +11,136 @@ static UINT8 *ObjMem = NULL;
 static INT32 nMax = 0;
 static INT32 nGetNext = 0;
 
-static INT32 nMaxZValue;
-static INT32 nMaxZMask;
+static CPS_TLS INT32 nMaxZValue;
+static CPS_TLS INT32 nMaxZMask;
+static CPS_TLS INT32 nMaxZWrite;			// Highest z value masked sprites could write
 
 static INT32 nZOffset;
+static INT32 nZMaskLast;					// Highest nMaxZMask drawn since CpsObjDrawInit
+static INT32 nZBufHigh;						// Highest z value in ZBuf (counting ZBuf8 frames)
+static INT32 bZMasked;						// Masked sprites were drawn since CpsObjDrawInit
+
+// Lists under 255 sprites are masked against the 8 bit ZBuf8, which is cleared
+// every frame: only the span of each line masked sprites were drawn over.
+// ZBuf8 is only used when nothing in ZBuf is above the frame's z offset, so it
+// masks exactly like ZBuf would, with z values nZ8Base lower.
+static INT32 bZBuf8 = 0;
+static INT32 nZ8Base = 0;
+static INT16 nZ8Start[224], nZ8End[224];
+
+static CPS_TLS INT32 nObjClipStart = 0, nObjClipEnd = 224;	// Lines of the screen band being drawn
+
+// A sprite from the list, decoded by CpsObjGet
+struct ObjSpr {
+	INT16 nX, nY;							// Position on screen (nX is the 10 bit x if a & 0x80, see Cps2ObjDraw)
+	UINT32 nTile;							// First tile
+	UINT16 nAttr;							// Palette, flip and size
+	UINT16 nIndex;							// Position in the list, the z value is worked out from it
+};
 
 // Object frames, so you can lag the Objs by nFrameCount-1 frames
 struct ObjFrame {
 	INT32 nShiftX, nShiftY;
 	UINT8* Obj;
 	INT32 nCount;
+	struct ObjSpr* Spr;						// The sprites sorted by priority level, in list order within a level
+	INT32 nLevel[9];						// Where each level starts in Spr (nLevel[8] is the end)
 };
 
 static INT32 nFrameCount = 0;
 static struct ObjFrame of[3];
 
+static struct ObjFrame *pDrawObj = NULL;	// The frame being drawn
+static struct ObjFrame DrawObj;				// Copy of it for the render thread
+static struct ObjFrame LastObj;				// The list the last frame drawn came from
+
+static struct ObjSpr *SprMem = NULL;
+
+// Clear the spans of ZBuf8 drawn on since the last time
+static void CpsObjZ8Clear(void)
+{
+	INT32 y;
+
+	for (y = 0; y < 224; y++) {
+		if (nZ8Start[y] < nZ8End[y])
+			memset(ZBuf8 + y * 384 + nZ8Start[y], 0, nZ8End[y] - nZ8Start[y]);
+		nZ8Start[y] = 384;
+		nZ8End[y] = 0;
+	}
+}
+
+// Copy the z values drawn on ZBuf8 since it was cleared into ZBuf
+static void CpsObjZ8Copy(void)
+{
+	INT32 x, y;
+
+	for (y = 0; y < 224; y++) {
+		for (x = nZ8Start[y]; x < nZ8End[y]; x++) {
+			if (ZBuf8[y * 384 + x])
+				ZBuf[y * 384 + x] = (UINT16)(nZ8Base + ZBuf8[y * 384 + x]);
+		}
+	}
+}
+
+// Note a masked sprite drawn over ZBuf8, clipped to the band
+static void CpsObjZ8Mark(INT32 x, INT32 y, INT32 nWidth, INT32 nHeight)
+{
+	INT32 nStart = y < nObjClipStart ? nObjClipStart : y;
+	INT32 nEnd = y + nHeight > nObjClipEnd ? nObjClipEnd : y + nHeight;
+	INT32 x0 = x < 0 ? 0 : x;
+	INT32 x1 = x + nWidth > 384 ? 384 : x + nWidth;
+
+	if (x0 >= x1)
+		return;
+
+	for (y = nStart; y < nEnd; y++) {
+		if (nZ8Start[y] > x0)
+			nZ8Start[y] = x0;
+		if (nZ8End[y] < x1)
+			nZ8End[y] = x1;
+	}
+}
+
 INT32 CpsObjInit(void)
 {
    INT32 i;
    nMax = 0x400; /* CPS2 has 1024 sprites */
 	nFrameCount = 2;			// CPS2 sprites lagged by 1 frame and double buffered
 								// CPS1 sprites lagged by 1 frame
-	ObjMem = (UINT8*)BurnMalloc((nMax << 3) * nFrameCount);
+	ObjMem = (UINT8*)BurnMalloc((nMax << 3) * (nFrameCount + 2));
 	if (!ObjMem)
 		return 1;
+	SprMem = (struct ObjSpr*)BurnMalloc(nMax * sizeof(struct ObjSpr) * (nFrameCount + 1));
+	if (!SprMem)
+		return 1;
 
 	// Set up the frame buffers
 	for (i = 0; i < nFrameCount; i++)
    {
 		of[i].Obj = ObjMem + (nMax << 3) * i;
 		of[i].nCount = 0;
+		of[i].Spr = SprMem + nMax * i;
+		memset(of[i].nLevel, 0, sizeof(of[i].nLevel));
 	}
 
+	DrawObj.Obj = ObjMem + (nMax << 3) * nFrameCount;
+	DrawObj.nCount = 0;
+	DrawObj.Spr = SprMem + nMax * nFrameCount;
+	memset(DrawObj.nLevel, 0, sizeof(DrawObj.nLevel));
+	LastObj.Obj = ObjMem + (nMax << 3) * (nFrameCount + 1);
+	LastObj.nCount = -1;
+	pDrawObj = of;
+
 	nGetNext=0;
 
    memset(ZBuf, 0, 384 * 224 * 2);
-   nMaxZMask = nZOffset = 0;
+   memset(ZBuf8, 0, 384 * 224);
+   CpsObjZ8Clear();
+   nMaxZMask = nZOffset = nZMaskLast = 0;
+   nMaxZWrite = nZBufHigh = 0;
+   bZMasked = 0;
    nMaxZValue = 1;
+   bZBuf8 = 0;
 
 	return 0;
 }
@@ -59,9 +152,16 @@ INT32 CpsObjExit(void)
    {
 		of[i].Obj = NULL;
 		of[i].nCount = 0;
+		of[i].Spr = NULL;
 	}
 
+	DrawObj.Obj = NULL;
+	DrawObj.Spr = NULL;
+	LastObj.Obj = NULL;
+	pDrawObj = NULL;
+
 	BurnFree(ObjMem);
+	BurnFree(SprMem);
 
 	nFrameCount = 0;
 	nMax = 0;
@@ -69,6 +169,47 @@ INT32 CpsObjExit(void)
 	return 0;
 }
 
+// Decode the copied sprites into pof->Spr, grouped by priority level so
+// Cps2ObjDraw only has to look at the levels it draws
+static void CpsObjSort(struct ObjFrame *pof)
+{
+	INT32 nNext[8];
+	INT32 i;
+	UINT16 *ps;
+
+	memset(pof->nLevel, 0, sizeof(pof->nLevel));
+
+	for (i = 0, ps = (UINT16*)pof->Obj; i < pof->nCount; i++, ps += 4)
+		pof->nLevel[(BURN_ENDIAN_SWAP_INT16(ps[0]) >> 13) + 1]++;
+	for (i = 0; i < 8; i++) {
+		pof->nLevel[i + 1] += pof->nLevel[i];
+		nNext[i] = pof->nLevel[i];
+	}
+
+	for (i = 0, ps = (UINT16*)pof->Obj; i < pof->nCount; i++, ps += 4) {
+		INT32 x = BURN_ENDIAN_SWAP_INT16(ps[0]);
+		INT32 y = BURN_ENDIAN_SWAP_INT16(ps[1]);
+		INT32 n = BURN_ENDIAN_SWAP_INT16(ps[2]);
+		INT32 a = BURN_ENDIAN_SWAP_INT16(ps[3]);
+		struct ObjSpr *pSpr = pof->Spr + nNext[x >> 13]++;
+
+		// CPS2 coords are 10 bit signed (-512 to 511)
+		x &= 0x03FF;
+		if ((a & 0x80) == 0) {
+			x ^= 0x200; x -= 0x200;
+			x += pof->nShiftX;
+		}
+		y &= 0x03FF; y ^= 0x200; y -= 0x200;
+		y += pof->nShiftY;		// Ignore sprite offsets when raster interrupts are used (seems to work for all games)
+
+		pSpr->nX = x;
+		pSpr->nY = y;
+		pSpr->nTile = n | ((BURN_ENDIAN_SWAP_INT16(ps[1]) & 0x6000) << 3);	// high bits of address
+		pSpr->nAttr = a;
+		pSpr->nIndex = i;
+	}
+}
+
 // Get CPS sprites into Obj
 INT32 CpsObjGet(void)
 {
@@ -113,6 +254,8 @@ INT32 CpsObjGet(void)
 		po += 8;
 	}
 
+	CpsObjSort(pof);
+
 	nGetNext++;
 	if (nGetNext >= nFrameCount)
 		nGetNext = 0;
@@ -122,116 +265,243 @@ INT32 CpsObjGet(void)
 
 void CpsObjDrawInit(void)
 {
-	nZOffset = nMaxZMask;
+	nZOffset = nZMaskLast;
 
 	if (nZOffset >= 0xFC00)
-   {
+	{
 		// The Z buffer might moverflow the next fram, so initialise it
 		memset(ZBuf, 0, 384 * 224 * 2);
 		nZOffset = 0;
+		nZBufHigh = 0;
+	}
+	else if (bZBuf8 && nZBufHigh > nZOffset)
+	{
+		// The last frame's sprites still mask this one, so put them in ZBuf
+		CpsObjZ8Copy();
+	}
+	nZMaskLast = nZOffset;
+
+	bZBuf8 = pDrawObj->nCount < 0xFF && nZBufHigh <= nZOffset;
+	bZMasked = 0;
+
+	if (bZBuf8)
+	{
+		// All the z values fit in ZBuf8, starting from a clear buffer
+		CpsObjZ8Clear();
+		nZ8Base = nZOffset;
+		nZOffset = 0;
 	}
 
+	CpsObjDrawBand(0, 224);
+
+	return;
+}
+
+// Start drawing the sprites for lines nBandStart to nBandEnd-1, on the calling thread.
+// Every band steps through the same sprite list, so they all end up with the same z values.
+void CpsObjDrawBand(INT32 nBandStart, INT32 nBandEnd)
+{
 	nMaxZValue = nZOffset + 1;
 	nMaxZMask = nZOffset;
+	nMaxZWrite = nZOffset;
 
-	return;
+	nObjClipStart = nBandStart;
+	nObjClipEnd = nBandEnd;
+}
+
+// Can be called after each part of the screen, if it is drawn in several goes
+void CpsObjDrawExit(void)
+{
+	INT32 nBase = bZBuf8 ? nZ8Base : 0;
+
+	if (nZMaskLast < nBase + nMaxZMask)
+		nZMaskLast = nBase + nMaxZMask;
+	if (nZBufHigh < nBase + nMaxZWrite)
+		nZBufHigh = nBase + nMaxZWrite;
+	if (nMaxZWrite > nZOffset)
+		bZMasked = 1;
+}
+
+// Pick the sprite list to draw (the earliest frame we have in history). The
+// render thread gets a copy, as CpsObjGet() reuses the frame while it draws.
+void CpsObjDrawSnapshot(INT32 bCopy)
+{
+	pDrawObj = of + nGetNext;
+
+	if (bCopy) {
+		memcpy(DrawObj.Obj, pDrawObj->Obj, pDrawObj->nCount << 3);
+		memcpy(DrawObj.Spr, pDrawObj->Spr, pDrawObj->nCount * sizeof(struct ObjSpr));
+		memcpy(DrawObj.nLevel, pDrawObj->nLevel, sizeof(DrawObj.nLevel));
+		DrawObj.nShiftX = pDrawObj->nShiftX;
+		DrawObj.nShiftY = pDrawObj->nShiftY;
+		DrawObj.nCount = pDrawObj->nCount;
+		pDrawObj = &DrawObj;
+	}
+}
+
+// Pick the same sprite list before CpsObjGet() is called for this frame, which is
+// the last frame got
+void CpsObjDrawLatest(void)
+{
+	pDrawObj = of + (nGetNext ? nGetNext : nFrameCount) - 1;
+}
+
+// Check if the sprite list CpsObjDrawSnapshot() would pick is the one last remembered.
+// Masked sprites depend on (and change) what the Z buffer holds from earlier frames,
+// so only a frame without them, and with nothing left in ZBuf to mask against, counts.
+INT32 CpsObjDrawSame(void)
+{
+	struct ObjFrame *pof = of + nGetNext;
+
+	if (bZMasked || nZBufHigh > nZMaskLast)
+		return 0;
+
+	if (pof->nCount != LastObj.nCount || pof->nShiftX != LastObj.nShiftX || pof->nShiftY != LastObj.nShiftY)
+		return 0;
+
+	return memcmp(pof->Obj, LastObj.Obj, pof->nCount << 3) == 0;
+}
+
+void CpsObjDrawRemember(void)
+{
+	struct ObjFrame *pof = of + nGetNext;
+
+	memcpy(LastObj.Obj, pof->Obj, pof->nCount << 3);
+	LastObj.nShiftX = pof->nShiftX;
+	LastObj.nShiftY = pof->nShiftY;
+	LastObj.nCount = pof->nCount;
+}
+
+// First sprite in nCount sorted sprites at or after list position nIndex
+static INLINE struct ObjSpr *CpsObjFind(struct ObjSpr *pSpr, INT32 nCount, INT32 nIndex)
+{
+	while (nCount > 0) {
+		INT32 nHalf = nCount >> 1;
+
+		if (pSpr[nHalf].nIndex < nIndex) {
+			pSpr += nHalf + 1;
+			nCount -= nHalf + 1;
+		} else {
+			nCount = nHalf;
+		}
+	}
+
+	return pSpr;
 }
 
 // Delay sprite drawing by one frame
 INT32 Cps2ObjDraw(INT32 nLevelFrom, INT32 nLevelTo)
 {
-	CpstOneDoFn pCpstOne;
-	const INT32 nPsAdd = 4;
-	BOOL bMask = 0;
-	// Draw the earliest frame we have in history
-	struct ObjFrame *pof = of + nGetNext;
-	// Point to Obj list
-	UINT16 *ps = (UINT16*)pof->Obj + nPsAdd * (nMaxZValue - nZOffset - 1);
-	INT32 nCount = nZOffset + pof->nCount;
+	UINT16 ZValue;
+	BOOL bMask;
+	struct ObjFrame *pof = pDrawObj;
+	struct ObjSpr *pNext[8], *pEnd[8];
+	INT32 nFirst = nMaxZValue - nZOffset - 1;	// List position to start from
+	INT32 nMaskFrom = pof->nCount;				// List position of the first higher sprite, later ones are masked
+	INT32 l;
+
+	CpstBatchBegin(nObjClipStart, nObjClipEnd);
+
+	// Start each level at the first sprite from nFirst on
+	for (l = 0; l < 8; l++) {
+		pNext[l] = CpsObjFind(pof->Spr + pof->nLevel[l], pof->nLevel[l + 1] - pof->nLevel[l], nFirst);
+		pEnd[l] = pof->Spr + pof->nLevel[l + 1];
+
+		if (l > nLevelTo && pNext[l] < pEnd[l] && pNext[l]->nIndex < nMaskFrom)
+			nMaskFrom = pNext[l]->nIndex;
+	}
 
-	// Go through all the Objs
-	for (ZValue = (UINT16)nMaxZValue; ZValue <= nCount; ZValue++, ps += nPsAdd)
+	// Go through the Objs between these levels, in list order
+	for (;;)
    {
       INT32 x, y, n, a, bx, by, dx, dy;
-      INT32 nFlip;
-      INT32 v = BURN_ENDIAN_SWAP_INT16(ps[0]) >> 13;
+      INT32 nFlip, nType;
+      UINT32 *pPal;
+      struct ObjSpr *pSpr = NULL;
+      INT32 nLevel = 0;
 
-      // Check if sprite is between these levels
-      if (v > nLevelTo)
+      for (l = nLevelFrom; l <= nLevelTo; l++)
       {
-         bMask = 1;
-         continue;
+         if (pNext[l] < pEnd[l] && (pSpr == NULL || pNext[l]->nIndex < pSpr->nIndex))
+         {
+            pSpr = pNext[l];
+            nLevel = l;
+         }
       }
-      if (v < nLevelFrom)
-         continue;
+      if (pSpr == NULL)
+         break;
+      pNext[nLevel]++;
+
+      ZValue = (UINT16)(nZOffset + 1 + pSpr->nIndex);
+
+      // Higher sprites have been skipped before this one
+      bMask = pSpr->nIndex > nMaskFrom;
 
       if (bMask)
          nMaxZMask = ZValue;
       else
          nMaxZValue = ZValue;
 
-      // Select CpstOne function;
-      if (bMask || nMaxZMask > nMaxZValue)
-         pCpstOne = CpstOneObjDoX[1];
-      else
-         pCpstOne = CpstOneObjDoX[0];
+      // Mask against higher sprites if any have been skipped
+      bMask = bMask || nMaxZMask > nMaxZValue;
 
-      x = BURN_ENDIAN_SWAP_INT16(ps[0]);
-      y = BURN_ENDIAN_SWAP_INT16(ps[1]);
-      n = BURN_ENDIAN_SWAP_INT16(ps[2]);
-      a = BURN_ENDIAN_SWAP_INT16(ps[3]);
+      // Every band must agree on this, so it's done before the band clipping
+      if (bMask && nMaxZWrite < ZValue)
+         nMaxZWrite = ZValue;
+
+      x = pSpr->nX;
+      y = pSpr->nY;
+      n = pSpr->nTile;
+      a = pSpr->nAttr;
 
       if (a & 0x80)	// marvel vs capcom ending sprite off-set
-         x += CpsSaveFrg[0][0x9];
-
-      // CPS2 coords are 10 bit signed (-512 to 511)
-      x &= 0x03FF; x ^= 0x200; x -= 0x200;
-      y &= 0x03FF; y ^= 0x200; y -= 0x200;
-
-#if 0
-      // This *MAY* be needed to get correct sprite positions when raster interrups are used.
-      if (nRasterline[1]) {
-         for (INT32 i = 1; i < MAX_RASTER; i++) {
-            if ((y < nRasterline[i]) || (nRasterline[i] == 0)) {
-               x -= CpsSaveFrg[i - 1][0x09];
-               y -= CpsSaveFrg[i - 1][0x0B];
-               break;
-            }
-         }
-      } else {
-         x -= CpsSaveFrg[0][0x9];
-         y -= CpsSaveFrg[0][0xB];
+      {
+         x += CpsDrawFrg[0][0x9];
+         x &= 0x03FF; x ^= 0x200; x -= 0x200;
+         x += pof->nShiftX;
       }
-#else
-      // Ignore sprite offsets when raster interrupts are used (seems to work for all games).
-      x += pof->nShiftX;
-      y += pof->nShiftY;
-
-      //		x -= CpsSaveFrg[0][0x9];
-      //		y -= CpsSaveFrg[0][0xB];
-
-#endif
-      n |= (BURN_ENDIAN_SWAP_INT16(ps[1]) & 0x6000) << 3;	// high bits of address
 
       // Find the palette for the tiles on this sprite
-      CpstPal = CpsPal + ((a & 0x1F) << 4);
+      pPal = CpsDrawPal + ((a & 0x1F) << 4);
 
       nFlip = (a >> 5) & 3;
       // Find out sprite size
       bx = ((a >> 8) & 15) + 1;
       by = ((a >> 12) & 15) + 1;
 
-      // Take care with tiles if the sprite goes off the screen
-      if (x < 0 || y < 0 || x + (bx << 4) > 383 || y + (by << 4) > 223)
-         nCpstType = CTT_16X16 | CTT_CARE;
+      // Skip sprites outside the band
+      if (y >= nObjClipEnd || y + (by << 4) <= nObjClipStart)
+         continue;
+
+      // Take care with tiles if the sprite goes off the screen (or the band)
+      if (x < 0 || y < nObjClipStart || x + (bx << 4) > 383 || y + (by << 4) > nObjClipEnd - 1)
+         nType = CTT_16X16 | CTT_CARE;
       else
-         nCpstType = CTT_16X16;
+         nType = CTT_16X16;
+
+      if (bMask)
+      {
+         nType |= CTT_MASK;
+         if (bZBuf8)
+         {
+            nType |= CTT_ZBUF8;
+            CpsObjZ8Mark(x, y, bx << 4, by << 4);
+         }
+      }
 
-      nCpstFlip = nFlip;
       for (dy = 0; dy < by; dy++) {
          for (dx = 0; dx < bx; dx++) {
+            struct CpstCmd *pCmd;
+            UINT32 nTile;
             INT32 ex, ey;
 
+            //				nTile = n + (dy << 4) + dx;								// normal version
+            nTile = (n & ~0x0F) + (dy << 4) + ((n + dx) & 0x0F);	// pgear fix
+            nTile <<= 7;						// Find real tile address
+
+            if (CpstTileBlankTest(CTT_16X16, nTile))
+               continue;
+
             if (nFlip & 1)
                ex = (bx - dx - 1);
             else
@@ -242,17 +512,19 @@ INT32 Cps2ObjDraw(INT32 nLevelFrom, INT32 nLevelTo)
             else
                ey = dy;
 
-            nCpstX = x + (ex << 4);
-            nCpstY = y + (ey << 4);
-
-            //				nCpstTile = n + (dy << 4) + dx;								// normal version
-            nCpstTile = (n & ~0x0F) + (dy << 4) + ((n + dx) & 0x0F);	// pgear fix
-            nCpstTile <<= 7;						// Find real tile address					
-
-            pCpstOne();
+            pCmd = CpstBatchAdd();
+            pCmd->nX = x + (ex << 4);
+            pCmd->nY = y + (ey << 4);
+            pCmd->nTile = nTile;
+            pCmd->pPal = pPal;
+            pCmd->nZValue = ZValue;
+            pCmd->nType = nType;
+            pCmd->nFlip = nFlip;
          }
       }
    }
 
+	CpstBatchFlush();
+
 	return 0;
 }
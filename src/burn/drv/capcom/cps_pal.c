@@ -7,25 +7,52 @@ UINT32* CpsPal = NULL;					// Hicolor version of palette
 INT32 nCpsPalCtrlReg;
 INT32 bCpsUpdatePalEveryFrame = 0;		// Some of the hacks need this as they don't write to CpsReg 0x0a
 
+static UINT32* CpsPalLut = NULL;		// Output colour (nBurnBpp) for every CPS colour word
+static UINT16* CpsPalLast = NULL;		// The colour words CpsPal was last worked out from
+
 INT32 CpsPalInit()
 {
 	INT32 nLen = 0;
+	INT32 i;
 
 	nLen = 0xc00 * sizeof(UINT32);
 	CpsPal = (UINT32*)BurnMalloc(nLen);
-	if (CpsPal == NULL)
+	CpsPalLut = (UINT32*)BurnMalloc(0x10000 * sizeof(UINT32));
+	CpsPalLast = (UINT16*)BurnMalloc(0xc00 * sizeof(UINT16));
+	if (CpsPal == NULL || CpsPalLut == NULL || CpsPalLast == NULL)
 		return 1;
 
+	for (i = 0; i < 0x10000; i++)
+   {
+		INT32 Bright = 0x0f + ((i >> 12) << 1);
+		INT32 r = ((i >> 8) & 0x0f) * 0x11 * Bright / 0x2d;
+		INT32 g = ((i >> 4) & 0x0f) * 0x11 * Bright / 0x2d;
+		INT32 b = ((i >> 0) & 0x0f) * 0x11 * Bright / 0x2d;
+
+		if (nBurnBpp == 4)
+			CpsPalLut[i] = (r << 16) | (g << 8) | b;	// XRGB8888
+		else
+			CpsPalLut[i] = BurnHighCol(r, g, b, 0);
+	}
+
+	// Start off in step with an all zero palette
+	memset(CpsPalLast, 0, 0xc00 * sizeof(UINT16));
+	for (i = 0; i < 0xc00; i++)
+		CpsPal[i] = CpsPalLut[0];
+
 	return 0;
 }
 
 INT32 CpsPalExit()
 {
 	BurnFree(CpsPal);
+	BurnFree(CpsPalLut);
+	BurnFree(CpsPalLast);
 	return 0;
 }
 
 // Update CpsPal with the new palette at pNewPal (length 0xc00 bytes)
+// Only the colours which changed since the last update are converted
 INT32 CpsPalUpdate(UINT8* pNewPal)
 {
    INT32 nPage;
@@ -36,17 +63,25 @@ INT32 CpsPalUpdate(UINT8* pNewPal)
    {
 		if (BIT(nCtrl, nPage))
       {
-         INT32 Offset;
-			for (Offset = 0; Offset < 0x200; ++Offset)
+			UINT16 *pLast = CpsPalLast + (0x200 * nPage);
+			UINT32 *pPal = CpsPal + (0x200 * nPage);
+
+			if (memcmp(pLast, PaletteRAM, 0x200 * sizeof(UINT16)))
          {
-				INT32 Palette = BURN_ENDIAN_SWAP_INT16(*(PaletteRAM++));
-				INT32 Bright = 0x0f + ((Palette >> 12) << 1);
-				INT32 r = ((Palette >> 8) & 0x0f) * 0x11 * Bright / 0x2d;
-				INT32 g = ((Palette >> 4) & 0x0f) * 0x11 * Bright / 0x2d;
-				INT32 b = ((Palette >> 0) & 0x0f) * 0x11 * Bright / 0x2d;
-				
-				CpsPal[(0x200 * nPage) + (Offset ^ 15)] = BurnHighCol(r, g, b, 0);
+            INT32 Offset;
+				for (Offset = 0; Offset < 0x200; ++Offset)
+            {
+					UINT16 Palette = PaletteRAM[Offset];
+
+					if (Palette != pLast[Offset])
+               {
+						pLast[Offset] = Palette;
+						pPal[Offset ^ 15] = CpsPalLut[BURN_ENDIAN_SWAP_INT16(Palette)];
+					}
+				}
 			}
+
+			PaletteRAM += 0x200;
 		}
 	}
 
@@ -14,6 +14,11 @@ static const INT32 nFirstLine = 0x10;							// The first scanline of the display
 
 static INT32 nCpsCyclesExtra;
 
+INT32 Cps2Z80SyncLines = 0;								// Also bring the QSound Z80 up to date every this many lines (set by the application)
+static INT32 nCpsSyncCycles;								// When the next Z80 sync is due
+
+#define CPS_EVENT_NEVER (0x7FFFFFFF)
+
 INT32 CpsDrawSpritesInReverse = 0;
 
 INT32 nIrqLine50, nIrqLine52;
@@ -101,6 +106,7 @@ static const struct eeprom_interface cps2_eeprom_interface =
 INT32 CpsRunInit()
 {
 	SekInit(0, 0x68000);					// Allocate 68000
+	SekSetIdleSkip(Cps2IdleSkip);			// Skip the 68000's wait for the frame
 	
 	if (CpsMemInit())						// Memory init
 		return 1;
@@ -127,6 +133,9 @@ INT32 CpsRunInit()
 	if (CpsRunInitCallbackFunction) {
 		CpsRunInitCallbackFunction();
 	}
+
+	if (CpstCacheInit())					// 8bpp tile cache (optional)
+		return 1;
 	
 	DrvReset();
 
@@ -142,6 +151,8 @@ INT32 CpsRunInit()
 
 INT32 CpsRunExit()
 {
+	DrawFnExit();						// Wait for the render thread before freeing anything
+
 	if (CpsBootlegEEPROM) EEPROMExit();
 
 	// Sound exit
@@ -154,6 +165,9 @@ INT32 CpsRunExit()
 
 	// Sprite Masking exit
 	ZBuf = NULL;
+	ZBuf8 = NULL;
+
+	CpstCacheExit();
 
 	// Memory exit
 	CpsRwExit();
@@ -217,7 +231,7 @@ static void DoIRQ()
 	// 0x52 - Beam synchronized interrupt #2 occurs at raster line.
 
 	// Trigger IRQ and copy registers.
-	if (nIrqLine >= nFirstLine) {
+	if (nIrqLine >= nFirstLine && nInterrupt < MAX_RASTER) {
 
 		nInterrupt++;
 		nRasterline[nInterrupt] = nIrqLine - nFirstLine;
@@ -232,6 +246,9 @@ static void DoIRQ()
 		nRasterline[nInterrupt] = 0;
 	}
 
+	if (nIrqLine >= nFirstLine)
+		CpsDrawLinesSplit(nIrqLine - nFirstLine);	// Does nothing unless drawing line by line
+
 	// Schedule next interrupt
 	if (!bEnableAutoIrq50) {
 		if (nIrqLine >= nIrqLine50) {
@@ -257,6 +274,22 @@ static void DoIRQ()
 	return;
 }
 
+// Run the 68000 for nCycles like SekRun, bringing the QSound Z80 up to date at
+// the sync points due on the way. With no sync points this is just SekRun.
+static void CpsSekRun(INT32 nCycles)
+{
+	INT32 nEnd = SekTotalCycles() + nCycles;
+
+	while (nCpsSyncCycles < nEnd) {
+		if (SekTotalCycles() < nCpsSyncCycles)
+			SekRun(nCpsSyncCycles - SekTotalCycles());
+		QsndSyncZ80();
+		nCpsSyncCycles += Cps2Z80SyncLines * nCpsCycles / nCpsNumScanlines;
+	}
+
+	SekRun(nEnd - SekTotalCycles());
+}
+
 INT32 Cps2Frame()
 {
 	INT32 nDisplayEnd, nNext;									// variables to keep track of executed 68K cyles
@@ -301,15 +334,19 @@ INT32 Cps2Frame()
 	}
 	ScheduleIRQ();
 
+	nCpsSyncCycles = CPS_EVENT_NEVER;
+	if (Cps2Z80SyncLines > 0 && !Cps2DisableQSnd)
+		nCpsSyncCycles = Cps2Z80SyncLines * nCpsCycles / nCpsNumScanlines;
+
 	SekIdle(nCpsCyclesExtra);
 
 	if (nIrqCycles < nCpsCycles * nFirstLine / nCpsNumScanlines) {
-		SekRun(nIrqCycles);
+		CpsSekRun(nIrqCycles);
 		DoIRQ();
 	}
 	nNext = nCpsCycles * nFirstLine / nCpsNumScanlines;
 	if (SekTotalCycles() < nNext) {
-		SekRun(nNext - SekTotalCycles());
+		CpsSekRun(nNext - SekTotalCycles());
 	}
 
 	CopyCpsReg(0);										// Get inititial copy of registers
@@ -321,24 +358,51 @@ INT32 Cps2Frame()
 		ScheduleIRQ();
 	}
 
-	for (i = 0; i < 3; i++) {
-		nNext = ((i + 1) * nDisplayEnd) / 3;			// find out next cycle count to run to
+	if (bCpsDrawLines) {
+		// Run a line at a time, drawing the lines as the registers change
+		if (!nSkipFrame)
+			CpsDrawLinesBegin();
+
+		for (i = 1; i <= 224; i++) {
+			nNext = nCpsCycles * (nFirstLine + i) / nCpsNumScanlines;
 
-		while (nNext > nIrqCycles && nInterrupt < MAX_RASTER) {
-			SekRun(nIrqCycles - SekTotalCycles());
-			DoIRQ();
+			while (nNext > nIrqCycles) {
+				CpsSekRun(nIrqCycles - SekTotalCycles());
+				DoIRQ();
+			}
+			if (SekTotalCycles() < nNext)
+				CpsSekRun(nNext - SekTotalCycles());
+
+			CpsDrawLinesSplit(i);
+		}
+
+		CpsDrawLinesEnd();
+	} else {
+		for (i = 0; i < 3; i++) {
+			nNext = ((i + 1) * nDisplayEnd) / 3;			// find out next cycle count to run to
+
+			while (nNext > nIrqCycles && nInterrupt < MAX_RASTER) {
+				CpsSekRun(nIrqCycles - SekTotalCycles());
+				DoIRQ();
+			}
+			CpsSekRun(nNext - SekTotalCycles());				// run cpu
 		}
-		SekRun(nNext - SekTotalCycles());				// run cpu
 	}
 	
+	BURN_PROF_ENTER(BURN_PROF_OBJ);
 	CpsObjGet();										// Get objects
+	BURN_PROF_LEAVE();
 
 //	nCpsCyclesSegment[0] = (nCpsCycles * nVBlank) / nCpsNumScanlines;
 //	nDone += SekRun(nCpsCyclesSegment[0] - nDone);
 
 	SekSetIRQLine(2, SEK_IRQSTATUS_AUTO);				// VBlank
-	if (!nSkipFrame) CpsDraw();
-	SekRun(nCpsCycles - SekTotalCycles());	
+	if (!nSkipFrame && !bCpsDrawLines) {
+		BURN_PROF_ENTER(BURN_PROF_DRAW);
+		CpsDraw();
+		BURN_PROF_LEAVE();
+	}
+	CpsSekRun(nCpsCycles - SekTotalCycles());
 
 	nCpsCyclesExtra = SekTotalCycles() - nCpsCycles;
 
@@ -2,14 +2,14 @@
 
 // CPS Scroll2 with Row scroll support
 
-UINT8 *CpsrBase=NULL; // Tile data base
-INT32 nCpsrScrX=0,nCpsrScrY=0; // Basic scroll info
-UINT16 *CpsrRows=NULL; // Row scroll table, 0x400 words long
-INT32 nCpsrRowStart=0; // Start of row scroll (can wrap?)
-static INT32 nShiftY=0;
-static INT32 EndLineInfo=0;
+CPS_TLS UINT8 *CpsrBase=NULL; // Tile data base
+CPS_TLS INT32 nCpsrScrX=0,nCpsrScrY=0; // Basic scroll info
+CPS_TLS UINT16 *CpsrRows=NULL; // Row scroll table, 0x400 words long
+CPS_TLS INT32 nCpsrRowStart=0; // Start of row scroll (can wrap?)
+static CPS_TLS INT32 nShiftY=0;
+static CPS_TLS INT32 EndLineInfo=0;
 
-struct CpsrLineInfo CpsrLineInfo[15];
+CPS_TLS struct CpsrLineInfo CpsrLineInfo[15];
 
 static void GetRowsRange(INT32 *pnStart,INT32 *pnWidth,INT32 nRowFrom,INT32 nRowTo)
 {
@@ -79,7 +79,7 @@ static INT32 PrepareRows(void)
       for (ty=0,pr=pli->Rows; ty<16; ty++,pr++,r++)
       {
         // Get the row offset, if it's in range
-        if (r>=0 && r<nEndline)
+        if (r>=0 && r<nSliceEnd)
         {
           INT32 v;
           v =(pli->nTileStart<<4)-nCpsrScrX;
@@ -114,7 +114,8 @@ INT32 Cps2rPrepare()
   struct CpsrLineInfo *pli;
   if (CpsrBase==NULL) return 1;
 
-  EndLineInfo = ((nEndline + 15) >> 4);
+  // Work out the whole slice, so the row shifts don't depend on the band being drawn
+  EndLineInfo = ((nSliceEnd + 15) >> 4);
 
   nShiftY=16-(nCpsrScrY&15);
   for (y = -1, pli = CpsrLineInfo; y < EndLineInfo; y++, pli++)
@@ -128,7 +129,7 @@ INT32 Cps2rPrepare()
       nRowFrom=(y<<4)+nShiftY;
       nRowTo=nRowFrom+16;
       if (nRowFrom < 0) nRowFrom = 0;
-      if (nRowTo > nEndline) nRowTo = nEndline;
+      if (nRowTo > nSliceEnd) nRowTo = nSliceEnd;
 
       // Shift by row table start offset
       nRowFrom+=nCpsrRowStart;
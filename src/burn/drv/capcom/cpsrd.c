@@ -2,9 +2,8 @@
 #include <retro_inline.h>
 
 // CPS Scroll2 with Row scroll - Draw
-static INT32 nKnowBlank=-1;	// The tile we know is blank
-static INT32 nFirstY, nLastY;
-static INT32 bVCare;
+static CPS_TLS INT32 nFirstY, nLastY;
+static CPS_TLS INT32 bVCare;
 
 static INLINE UINT16 *FindTile(INT32 fx,INT32 fy)
 {
@@ -22,34 +21,32 @@ static void Cps2TileLine(INT32 y,INT32 sx)
    sy=16-(nCpsrScrY&15);
    iy=(nCpsrScrY>>4)+1;
 
-   nCpstY=sy+(y<<4);
-
    for (x=-1; x<24; x++)
    {
+      struct CpstCmd *pCmd;
       UINT16 *pst;
       INT32 t,a;
 
-      nCpstType = CTT_16X16;
-
-      // Don't need to clip except around the border
-      if (bVCare || x<0 || x>=24-1)
-         nCpstType |= CTT_CARE;
-
       pst = FindTile(ix+x,iy+y);
 
       t = BURN_ENDIAN_SWAP_INT16(pst[0]);
       t<<=7; // Get real tile address
       t+=nCpsGfxScroll[2]; // add on offset to scroll tiles
 
-      if (t==nKnowBlank)
-         continue; // Don't draw: we know it's blank
+      if (CpstTileBlankTest(CTT_16X16, t))
+         continue; // Don't draw: it's blank
 
       a = BURN_ENDIAN_SWAP_INT16(pst[1]);
 
-      CpstSetPal(0x40 | (a&0x1f));
-      nCpstX=sx+(x<<4); nCpstTile=t; nCpstFlip=(a>>5)&3;
-      if (Cps2tOne())
-         nKnowBlank=t;
+      pCmd = CpstBatchAdd();
+      pCmd->nType = CTT_16X16;
+
+      // Don't need to clip except around the border
+      if (bVCare || x<0 || x>=24-1)
+         pCmd->nType |= CTT_CARE;
+
+      pCmd->pPal=CpstGetPal(0x40 | (a&0x1f));
+      pCmd->nX=sx+(x<<4); pCmd->nY=sy+(y<<4); pCmd->nTile=t; pCmd->nFlip=(a>>5)&3;
    }
 }
 
@@ -59,8 +56,6 @@ static void Cps2TileLineRows(INT32 y,struct CpsrLineInfo *pli)
   INT32 nLimLeft,nLimRight;
   INT32 nTileCount=pli->nTileEnd-pli->nTileStart;
   INT32 sy=16-(nCpsrScrY&15); iy=(nCpsrScrY>>4)+1;
-  nCpstY=sy+(y<<4);
-  CpstRowShift=pli->Rows;
 
   // If these rowshift limits go off the edges, we should take
   // care drawing the tile.
@@ -69,6 +64,7 @@ static void Cps2TileLineRows(INT32 y,struct CpsrLineInfo *pli)
 
   for (x=0; x<nTileCount; x++, nLimLeft+=16, nLimRight+=16)
   {
+     struct CpstCmd *pCmd;
      UINT16 *pst;
      INT32 t,a;
      INT32 tx=pli->nTileStart+x;
@@ -84,26 +80,26 @@ static void Cps2TileLineRows(INT32 y,struct CpsrLineInfo *pli)
            bCare=1; // Will cross right edge
      }
 
-     nCpstType = CTT_16X16 | CTT_ROWS;
-
-     if (bCare)
-        nCpstType |= CTT_CARE;
-
      pst = FindTile(tx,iy+y);
      t = BURN_ENDIAN_SWAP_INT16(pst[0]);
      t<<=7; // Get real tile address
      t+=nCpsGfxScroll[2]; // add on offset to scroll tiles
 
-     if (t==nKnowBlank)
-        continue; // Don't draw: we know it's blank
+     if (CpstTileBlankTest(CTT_16X16, t))
+        continue; // Don't draw: it's blank
 
      a = BURN_ENDIAN_SWAP_INT16(pst[1]);
 
-     CpstSetPal(0x40 | (a&0x1f));
+     pCmd = CpstBatchAdd();
+     pCmd->nType = CTT_16X16 | CTT_ROWS;
+
+     if (bCare)
+        pCmd->nType |= CTT_CARE;
+
+     pCmd->pPal=CpstGetPal(0x40 | (a&0x1f));
+     pCmd->pRows=pli->Rows;
 
-     nCpstX=x<<4; nCpstTile=t; nCpstFlip=(a>>5)&3;
-     if(Cps2tOne())
-        nKnowBlank=t;
+     pCmd->nX=x<<4; pCmd->nY=sy+(y<<4); pCmd->nTile=t; pCmd->nFlip=(a>>5)&3;
   }
 }
 
@@ -114,14 +110,17 @@ INT32 Cps2rRender(void)
    if (!CpsrBase)
       return 1;
 
-   nKnowBlank = -1;					// We don't know which tile is blank yet
+   CpstBatchBegin(nStartline, nEndline);
 
    nLastY = (nEndline + (nCpsrScrY & 15)) >> 4;
    nFirstY = (nStartline + (nCpsrScrY & 15)) >> 4;
 
    for (y = nFirstY - 1, pli = CpsrLineInfo + nFirstY; y < nLastY; y++, pli++)
    {
-      bVCare = ((y << 4) < nStartline) | (((y << 4) + 16) >= nEndline);
+      INT32 nTileY = 16 - (nCpsrScrY & 15) + (y << 4);
+
+      // Clip tile lines which cross the top or bottom of the slice
+      bVCare = (nTileY < nStartline) | ((nTileY + 16) > nEndline);
 
       if (pli->nWidth==0)
          Cps2TileLine(y,pli->nStart);	// no rowscroll needed
@@ -129,5 +128,7 @@ INT32 Cps2rRender(void)
          Cps2TileLineRows(y,pli);		// row scroll
    }
 
+   CpstBatchFlush();
+
    return 0;
 }
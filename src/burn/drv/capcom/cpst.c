@@ -1,164 +1,374 @@
 #include "cps.h"
-// CPS Tile Variants
-// horizontal/vertical clip rolls
-UINT32 nCtvRollX=0,nCtvRollY=0;
-// Add 0x7fff after each pixel/line
-// If nRollX/Y&0x20004000 both == 0, you can draw the pixel
+// CPS Tiles
+
+// Tiles are queued by the layer/sprite drawing code and drawn in runs:
+// consecutive tiles of the same variant are handed to one specialised
+// function, which keeps all per-tile state in locals.
+CPS_TLS struct CpstCmd CpstBatch[CPST_BATCH_SIZE];
+CPS_TLS INT32 nCpstBatchCount = 0;
+
+static CPS_TLS INT32 nCtvClipStart = 0, nCtvClipEnd = 224;	// Vertical clip window for CTT_CARE tiles
+
+UINT16* ZBuf = NULL;
+UINT8* ZBuf8 = NULL;
+
+// Tile flags: a bit per 8x8, 16x16 and 32x32 tile in CpsGfx
+UINT32* CpstTileBlank[3] = { NULL, NULL, NULL };	// No pixels set
+UINT32* CpstTileOpaque[3] = { NULL, NULL, NULL };	// All pixels set
+
+// 8bpp tile cache
+INT32 bCpstGfx8 = 0;					// Set by the application before init to build the cache
+UINT8* CpsGfx8 = NULL;					// CpsGfx with one pixel per byte, in drawing order
+
+#if (defined(__i386__) || defined(__x86_64__)) && defined(__GNUC__)
+// SSSE3 versions of the tile kernels, picked by CtvReady() if the cpu has it.
+// pshufb does the 16 colour palette lookup for a whole 8 pixel group at once.
+#include <tmmintrin.h>
+
+#define CTV_SIMD __attribute__((target("ssse3")))
+
+// Split the 16 colours into low and high byte planes for _mm_shuffle_epi8
+static INLINE CTV_SIMD void CtvSimdPal(UINT32 *ctp, __m128i *pLo, __m128i *pHi)
+{
+	const __m128i nSel = _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, -1, -1, -1, -1, -1, -1, -1, -1);
+	__m128i p0 = _mm_shuffle_epi8(_mm_loadu_si128((__m128i *)(ctp +  0)), nSel);
+	__m128i p1 = _mm_shuffle_epi8(_mm_loadu_si128((__m128i *)(ctp +  4)), nSel);
+	__m128i p2 = _mm_shuffle_epi8(_mm_loadu_si128((__m128i *)(ctp +  8)), nSel);
+	__m128i p3 = _mm_shuffle_epi8(_mm_loadu_si128((__m128i *)(ctp + 12)), nSel);
+
+	p0 = _mm_unpacklo_epi32(p0, p1);
+	p2 = _mm_unpacklo_epi32(p2, p3);
+
+	*pLo = _mm_unpacklo_epi64(p0, p2);
+	*pHi = _mm_unpackhi_epi64(p0, p2);
+}
+
+// Unpack 8 packed pixels into 8 byte indexes, in drawing order
+static INLINE CTV_SIMD __m128i CtvSimdIndex(UINT32 b, INT32 bFlipX)
+{
+	const __m128i nNibble = _mm_set1_epi8(0x0f);
+	__m128i v, vHi, vLo;
+
+	if (!bFlipX)
+		b = __builtin_bswap32(b);
+
+	v = _mm_cvtsi32_si128(b);
+	vHi = _mm_and_si128(_mm_srli_epi16(v, 4), nNibble);
+	vLo = _mm_and_si128(v, nNibble);
+
+	if (bFlipX)
+		return _mm_unpacklo_epi8(vLo, vHi);
+
+	return _mm_unpacklo_epi8(vHi, vLo);
+}
+
+// Load 8 pixels from the 8bpp cache, in drawing order
+static INLINE CTV_SIMD __m128i CtvSimdIndex8(UINT8 *s, INT32 bFlipX)
+{
+	__m128i v = _mm_loadl_epi64((__m128i *)s);
 
-UINT8 *pCtvTile=NULL; // Pointer to tile data
-INT32 nCtvTileAdd=0; // Amount to add after each tile line
-UINT8 *pCtvLine=NULL; // Pointer to output bitmap
+	if (bFlipX)
+		v = _mm_shuffle_epi8(v, _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, -1, -1, -1, -1, -1, -1, -1, -1));
+
+	return v;
+}
+
+// vOpaque is all ones for tiles without transparent pixels
+static INLINE CTV_SIMD void CtvSimdRow(UINT16 *pPix, __m128i vIdx, __m128i vPalLo, __m128i vPalHi, __m128i vOpaque)
+{
+	__m128i vCol = _mm_unpacklo_epi8(_mm_shuffle_epi8(vPalLo, vIdx), _mm_shuffle_epi8(vPalHi, vIdx));
+	__m128i vTrans = _mm_cmpeq_epi8(_mm_or_si128(vIdx, vOpaque), _mm_setzero_si128());
+	__m128i vDst = _mm_loadu_si128((__m128i *)pPix);
+
+	vTrans = _mm_unpacklo_epi8(vTrans, vTrans);
+	vDst = _mm_or_si128(_mm_and_si128(vTrans, vDst), _mm_andnot_si128(vTrans, vCol));
+
+	_mm_storeu_si128((__m128i *)pPix, vDst);
+}
+
+static INLINE CTV_SIMD void CtvSimdRowZ(UINT16 *pPix, UINT16 *pPixZ, __m128i vIdx, __m128i vPalLo, __m128i vPalHi, __m128i vOpaque, UINT16 nZValue)
+{
+	const __m128i nSign = _mm_set1_epi16((INT16)0x8000);
+	__m128i vCol = _mm_unpacklo_epi8(_mm_shuffle_epi8(vPalLo, vIdx), _mm_shuffle_epi8(vPalHi, vIdx));
+	__m128i vTrans = _mm_cmpeq_epi8(_mm_or_si128(vIdx, vOpaque), _mm_setzero_si128());
+	__m128i vZ = _mm_set1_epi16((INT16)nZValue);
+	__m128i vDstZ = _mm_loadu_si128((__m128i *)pPixZ);
+	__m128i vDst = _mm_loadu_si128((__m128i *)pPix);
+	__m128i vDraw;
+
+	// Draw where the pixel is opaque and *pPixZ < nZValue (unsigned)
+	vDraw = _mm_cmplt_epi16(_mm_xor_si128(vDstZ, nSign), _mm_xor_si128(vZ, nSign));
+	vDraw = _mm_andnot_si128(_mm_unpacklo_epi8(vTrans, vTrans), vDraw);
+
+	vDst = _mm_or_si128(_mm_andnot_si128(vDraw, vDst), _mm_and_si128(vDraw, vCol));
+	vDstZ = _mm_or_si128(_mm_andnot_si128(vDraw, vDstZ), _mm_and_si128(vDraw, vZ));
+
+	_mm_storeu_si128((__m128i *)pPix, vDst);
+	_mm_storeu_si128((__m128i *)pPixZ, vDstZ);
+}
+
+// The same against the 8 bit ZBuf8
+static INLINE CTV_SIMD void CtvSimdRowZ8(UINT16 *pPix, UINT8 *pPixZ, __m128i vIdx, __m128i vPalLo, __m128i vPalHi, __m128i vOpaque, UINT8 nZValue)
+{
+	__m128i vCol = _mm_unpacklo_epi8(_mm_shuffle_epi8(vPalLo, vIdx), _mm_shuffle_epi8(vPalHi, vIdx));
+	__m128i vTrans = _mm_cmpeq_epi8(_mm_or_si128(vIdx, vOpaque), _mm_setzero_si128());
+	__m128i vZ = _mm_set1_epi8((INT8)nZValue);
+	__m128i vDstZ = _mm_loadl_epi64((__m128i *)pPixZ);
+	__m128i vDst = _mm_loadu_si128((__m128i *)pPix);
+	__m128i vKeep, vKeep16;
+
+	// Keep where the pixel is transparent or *pPixZ >= nZValue (unsigned)
+	vKeep = _mm_or_si128(vTrans, _mm_cmpeq_epi8(_mm_max_epu8(vDstZ, vZ), vDstZ));
+	vKeep16 = _mm_unpacklo_epi8(vKeep, vKeep);
+
+	vDst = _mm_or_si128(_mm_and_si128(vKeep16, vDst), _mm_andnot_si128(vKeep16, vCol));
+	vDstZ = _mm_or_si128(_mm_and_si128(vKeep, vDstZ), _mm_andnot_si128(vKeep, vZ));
+
+	_mm_storeu_si128((__m128i *)pPix, vDst);
+	_mm_storel_epi64((__m128i *)pPixZ, vDstZ);
+}
+
+// 32 bit versions: the palette is split into four byte planes, and each
+// group of 8 pixels is written as two halves of 4
+
+static INLINE CTV_SIMD void CtvSimdPal32(UINT32 *ctp, __m128i *pPal)
+{
+	const __m128i nSel = _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+	__m128i p0 = _mm_shuffle_epi8(_mm_loadu_si128((__m128i *)(ctp +  0)), nSel);
+	__m128i p1 = _mm_shuffle_epi8(_mm_loadu_si128((__m128i *)(ctp +  4)), nSel);
+	__m128i p2 = _mm_shuffle_epi8(_mm_loadu_si128((__m128i *)(ctp +  8)), nSel);
+	__m128i p3 = _mm_shuffle_epi8(_mm_loadu_si128((__m128i *)(ctp + 12)), nSel);
+	__m128i q0 = _mm_unpacklo_epi32(p0, p1);
+	__m128i q1 = _mm_unpackhi_epi32(p0, p1);
+	__m128i q2 = _mm_unpacklo_epi32(p2, p3);
+	__m128i q3 = _mm_unpackhi_epi32(p2, p3);
+
+	pPal[0] = _mm_unpacklo_epi64(q0, q2);
+	pPal[1] = _mm_unpackhi_epi64(q0, q2);
+	pPal[2] = _mm_unpacklo_epi64(q1, q3);
+	pPal[3] = _mm_unpackhi_epi64(q1, q3);
+}
+
+// Look up the colours of 8 pixels, pixels 0-3 in *pLo and 4-7 in *pHi
+static INLINE CTV_SIMD void CtvSimdCol32(__m128i vIdx, __m128i *pPal, __m128i *pLo, __m128i *pHi)
+{
+	__m128i v01 = _mm_unpacklo_epi8(_mm_shuffle_epi8(pPal[0], vIdx), _mm_shuffle_epi8(pPal[1], vIdx));
+	__m128i v23 = _mm_unpacklo_epi8(_mm_shuffle_epi8(pPal[2], vIdx), _mm_shuffle_epi8(pPal[3], vIdx));
+
+	*pLo = _mm_unpacklo_epi16(v01, v23);
+	*pHi = _mm_unpackhi_epi16(v01, v23);
+}
+
+// Write the colours where the 16 bit lanes of vDraw are set
+static INLINE CTV_SIMD void CtvSimdPut32(UINT32 *pPix, __m128i vLo, __m128i vHi, __m128i vDraw)
+{
+	__m128i vDrawLo = _mm_unpacklo_epi16(vDraw, vDraw);
+	__m128i vDrawHi = _mm_unpackhi_epi16(vDraw, vDraw);
+	__m128i vDst0 = _mm_loadu_si128((__m128i *)pPix);
+	__m128i vDst1 = _mm_loadu_si128((__m128i *)(pPix + 4));
+
+	vDst0 = _mm_or_si128(_mm_andnot_si128(vDrawLo, vDst0), _mm_and_si128(vDrawLo, vLo));
+	vDst1 = _mm_or_si128(_mm_andnot_si128(vDrawHi, vDst1), _mm_and_si128(vDrawHi, vHi));
+
+	_mm_storeu_si128((__m128i *)pPix, vDst0);
+	_mm_storeu_si128((__m128i *)(pPix + 4), vDst1);
+}
+
+static INLINE CTV_SIMD void CtvSimdRow32(UINT32 *pPix, __m128i vIdx, __m128i *pPal, __m128i vOpaque)
+{
+	__m128i vTrans = _mm_cmpeq_epi8(_mm_or_si128(vIdx, vOpaque), _mm_setzero_si128());
+	__m128i vLo, vHi;
+
+	CtvSimdCol32(vIdx, pPal, &vLo, &vHi);
+	vTrans = _mm_unpacklo_epi8(vTrans, vTrans);
+	CtvSimdPut32(pPix, vLo, vHi, _mm_andnot_si128(vTrans, _mm_cmpeq_epi8(vTrans, vTrans)));
+}
+
+static INLINE CTV_SIMD void CtvSimdRow32Z(UINT32 *pPix, UINT16 *pPixZ, __m128i vIdx, __m128i *pPal, __m128i vOpaque, UINT16 nZValue)
+{
+	const __m128i nSign = _mm_set1_epi16((INT16)0x8000);
+	__m128i vTrans = _mm_cmpeq_epi8(_mm_or_si128(vIdx, vOpaque), _mm_setzero_si128());
+	__m128i vZ = _mm_set1_epi16((INT16)nZValue);
+	__m128i vDstZ = _mm_loadu_si128((__m128i *)pPixZ);
+	__m128i vLo, vHi, vDraw;
+
+	// Draw where the pixel is opaque and *pPixZ < nZValue (unsigned)
+	vDraw = _mm_cmplt_epi16(_mm_xor_si128(vDstZ, nSign), _mm_xor_si128(vZ, nSign));
+	vDraw = _mm_andnot_si128(_mm_unpacklo_epi8(vTrans, vTrans), vDraw);
+
+	CtvSimdCol32(vIdx, pPal, &vLo, &vHi);
+	CtvSimdPut32(pPix, vLo, vHi, vDraw);
+
+	vDstZ = _mm_or_si128(_mm_andnot_si128(vDraw, vDstZ), _mm_and_si128(vDraw, vZ));
+	_mm_storeu_si128((__m128i *)pPixZ, vDstZ);
+}
+
+static INLINE CTV_SIMD void CtvSimdRow32Z8(UINT32 *pPix, UINT8 *pPixZ, __m128i vIdx, __m128i *pPal, __m128i vOpaque, UINT8 nZValue)
+{
+	__m128i vTrans = _mm_cmpeq_epi8(_mm_or_si128(vIdx, vOpaque), _mm_setzero_si128());
+	__m128i vZ = _mm_set1_epi8((INT8)nZValue);
+	__m128i vDstZ = _mm_loadl_epi64((__m128i *)pPixZ);
+	__m128i vLo, vHi, vKeep;
+
+	// Keep where the pixel is transparent or *pPixZ >= nZValue (unsigned)
+	vKeep = _mm_or_si128(vTrans, _mm_cmpeq_epi8(_mm_max_epu8(vDstZ, vZ), vDstZ));
+
+	CtvSimdCol32(vIdx, pPal, &vLo, &vHi);
+	CtvSimdPut32(pPix, vLo, vHi, _mm_andnot_si128(_mm_unpacklo_epi8(vKeep, vKeep), _mm_cmpeq_epi8(vKeep, vKeep)));
+
+	vDstZ = _mm_or_si128(_mm_and_si128(vKeep, vDstZ), _mm_andnot_si128(vKeep, vZ));
+	_mm_storel_epi64((__m128i *)pPixZ, vDstZ);
+}
+#endif
 
 // Include all tile variants:
 #include "ctv.h"
 
-// CPS Tiles
-UINT32 *CpstPal=NULL;
-
-// Arguments for the tile draw function
-UINT32 nCpstType = 0;
-INT32 nCpstX = 0, nCpstY = 0;
-UINT32 nCpstTile = 0;
-INT32 nCpstFlip = 0;
-INT16 *CpstRowShift = NULL;
-UINT32 CpstPmsk = 0;		// Pixel mask
-
-INT32 nBgHi = 0;
-UINT16  ZValue = 1;
-UINT16* ZBuf = NULL;
-UINT16* pZVal = NULL;
-
-static INT32 CpstOne();
-INT32 Cps2tOne();
-static INT32 CpstOneObjZ();
-CpstOneDoFn CpstOneObjDoX[2] = { CpstOne, CpstOneObjZ};
-
-static INT32 CpstOne()
-{
-   INT32 nFun; INT32 nSize;
-   nSize=(nCpstType&24)+8;
-
-   if (nCpstType&CTT_CARE)
-   {
-      if ((nCpstType&CTT_ROWS)==0)
-      {
-         // Return if not visible at all
-         if (nCpstX <= -nSize)
-            return 0;
-         if (nCpstX >= 384)
-            return 0;
-         if (nCpstY <= -nSize)
-            return 0;
-         if (nCpstY >= 224)
-            return 0;
-      }
-      nCtvRollX=0x4000017f + nCpstX * 0x7fff;
-      nCtvRollY=0x400000df + nCpstY * 0x7fff;
-   }
-
-   // Clip to loaded graphics data (we have a gap of 0x200 at the end)
-   nCpstTile&=nCpsGfxMask; if (nCpstTile>=nCpsGfxLen) return 1;
-   pCtvTile=CpsGfx+nCpstTile;
-
-   // Find pLine (pointer to first pixel)
-   pCtvLine=pBurnDraw + nCpstY*nBurnPitch + nCpstX*nBurnBpp;
-
-   if (nSize==32) nCtvTileAdd=16; else nCtvTileAdd=8;
-
-   if (nCpstFlip&2)
-   {
-      // Flip vertically
-      if (nSize==16) { nCtvTileAdd= -8; pCtvTile+=15* 8; }
-      else if (nSize==32) { nCtvTileAdd=-16; pCtvTile+=31*16; }
-      else                { nCtvTileAdd= -8; pCtvTile+= 7* 8; }
-   }
-
-   nFun =nCpstType&0x1e;
-   nFun|=nCpstFlip&1;
-   return CtvDo2[nFun]();
-}
-
-INT32 Cps2tOne()
-{
-  INT32 nFun; INT32 nSize;
-  nSize=(nCpstType&24)+8;
-
-  if (nCpstType&CTT_CARE)
-  {
-    if ((nCpstType&CTT_ROWS)==0)
-    {
-     // Return if not visible at all
-     if (nCpstX <= -nSize) return 0;
-     if (nCpstX >= 384)    return 0;
-     if (nCpstY <= -nStartline - nSize) return 0;
-     if (nCpstY >= nEndline)    return 0;
-    }
-    nCtvRollX=0x4000017f + nCpstX * 0x7fff;
-    nCtvRollY=0x40000000 + nEndline - nStartline - 1 + (nCpstY - nStartline) * 0x7fff;
-  }
-
-  // Clip to loaded graphics data (we have a gap of 0x200 at the end)
-  nCpstTile&=nCpsGfxMask; if (nCpstTile>=nCpsGfxLen) return 0;
-  pCtvTile=CpsGfx+nCpstTile;
-
-  // Find pLine (pointer to first pixel)
-  pCtvLine=pBurnDraw + nCpstY*nBurnPitch + nCpstX*nBurnBpp;
-
-  if (nSize==32) nCtvTileAdd=16; else nCtvTileAdd=8;
-
-  if (nCpstFlip&2)
-  {
-    // Flip vertically
-         if (nSize==16) { nCtvTileAdd= -8; pCtvTile+=15* 8; }
-    else if (nSize==32) { nCtvTileAdd=-16; pCtvTile+=31*16; }
-    else                { nCtvTileAdd= -8; pCtvTile+= 7* 8; }
-  }
-
-  nFun =nCpstType&0x1e;
-  nFun|=nCpstFlip&1;
-  return CtvDo2[nFun]();
-}
-
-static INT32 CpstOneObjZ()
-{
-  INT32 nFun; INT32 nSize;
-  nSize=(nCpstType&24)+8;
-
-
-  if (nCpstType&CTT_CARE)
-  {
-    if ((nCpstType&CTT_ROWS)==0)
-    {
-      // Return if not visible at all
-		if (nCpstX <= -nSize) return 0;
-		if (nCpstX >= 384)    return 0;
-		if (nCpstY <= -nSize) return 0;
-		if (nCpstY >= 224)    return 0;
-    }
-    nCtvRollX=0x4000017f + nCpstX * 0x7fff;
-    nCtvRollY=0x400000df + nCpstY * 0x7fff;
-  }
-
-
-  // Clip to loaded graphics data (we have a gap of 0x200 at the end)
-  nCpstTile&=nCpsGfxMask; if (nCpstTile>=nCpsGfxLen) return 1;
-  pCtvTile=CpsGfx+nCpstTile;
-
-  // Find pLine (pointer to first pixel)
-  pCtvLine=pBurnDraw + nCpstY*nBurnPitch + nCpstX*nBurnBpp;
-  pZVal=ZBuf + nCpstY*384 + nCpstX;
-
-  if (nSize==32) nCtvTileAdd=16; else nCtvTileAdd=8;
-
-  if (nCpstFlip&2)
-  {
-    // Flip vertically
-         if (nSize==16) { nCtvTileAdd= -8; pCtvTile+=15* 8; }
-    else if (nSize==32) { nCtvTileAdd=-16; pCtvTile+=31*16; }
-    else                { nCtvTileAdd= -8; pCtvTile+= 7* 8; }
-  }
-
-  nFun =nCpstType&0x1e;
-  nFun|=nCpstFlip&1;
-  return CtvDo2m[nFun]();
+static CtvDoFn *pCtvDo = CtvDo2;
+
+UINT8 *pCtvDraw = NULL;
+INT32 nCtvPitch = 0;
+
+// Point to correct tile drawing functions
+INT32 CtvReady()
+{
+	INT32 bGfx8 = (CpsGfx8 != NULL);
+
+	// The frame may be drawn on another thread while pBurnDraw moves on
+	pCtvDraw = pBurnDraw;
+	nCtvPitch = nBurnPitch;
+
+	if (nBurnBpp == 4)
+		pCtvDo = bGfx8 ? CtvDo4g : CtvDo4;
+	else
+		pCtvDo = bGfx8 ? CtvDo2g : CtvDo2;
+
+#if defined(CTV_SIMD)
+	if (__builtin_cpu_supports("ssse3")) {
+		if (nBurnBpp == 4)
+			pCtvDo = bGfx8 ? CtvDo4gv : CtvDo4v;
+		else
+			pCtvDo = bGfx8 ? CtvDo2gv : CtvDo2v;
+	}
+#endif
+
+	return 0;
+}
+
+// Work out the blank/opaque bits for one tile size: each tile is nRows rows
+// of nWords packed words, nRowAdd bytes apart
+static void CpstTileFlagsCalc(INT32 i, INT32 nShift, INT32 nRows, INT32 nWords, INT32 nRowAdd)
+{
+	UINT32 nTiles = (nCpsGfxLen + (1 << nShift) - 1) >> nShift;
+	UINT32 n;
+
+	for (n = 0; n < nTiles; n++) {
+		UINT8 *pTile = CpsGfx + (n << nShift);
+		UINT32 nAny = 0, nAll = 0x11111111;
+		INT32 y, x;
+
+		for (y = 0; y < nRows; y++, pTile += nRowAdd) {
+			for (x = 0; x < nWords; x++) {
+				UINT32 b = ((UINT32 *)pTile)[x];
+				nAny |= b;
+				nAll &= b | (b >> 1) | (b >> 2) | (b >> 3);
+			}
+		}
+
+		if (nAny == 0)
+			CpstTileBlank[i][n >> 5] |= 1 << (n & 31);
+		if ((nAll & 0x11111111) == 0x11111111)
+			CpstTileOpaque[i][n >> 5] |= 1 << (n & 31);
+	}
+}
+
+// Build the per tile flags, and the 8bpp copy of CpsGfx if it was asked for,
+// once the graphics are loaded
+INT32 CpstCacheInit()
+{
+	static const INT32 nShift[3] = { 6, 7, 9 };
+	UINT32 nLen, n;
+	INT32 i;
+
+	CpstCacheExit();
+
+	if (nCpsGfxLen == 0)
+		return 0;
+
+	for (i = 0; i < 3; i++) {
+		UINT32 nSize = (((nCpsGfxLen >> nShift[i]) + 32) >> 5) * sizeof(UINT32);
+
+		CpstTileBlank[i] = (UINT32*)BurnMalloc(nSize);
+		CpstTileOpaque[i] = (UINT32*)BurnMalloc(nSize);
+		if (CpstTileBlank[i] == NULL || CpstTileOpaque[i] == NULL) {
+			CpstCacheExit();
+			return 1;
+		}
+	}
+
+	CpstTileFlagsCalc(0, 6,  8, 1,  8);		// 8x8
+	CpstTileFlagsCalc(1, 7, 16, 2,  8);		// 16x16
+	CpstTileFlagsCalc(2, 9, 32, 4, 16);		// 32x32
+
+	if (!bCpstGfx8)
+		return 0;
+
+	// Tiles near the end can read into the 0x200 gap after CpsGfx
+	nLen = nCpsGfxLen + 0x200;
+
+	CpsGfx8 = (UINT8*)BurnMalloc(nLen * 2);
+	if (CpsGfx8 == NULL) {
+		CpstCacheExit();
+		return 1;
+	}
+
+	for (n = 0; n < nLen; n += 4) {
+		UINT32 b = *((UINT32 *)(CpsGfx + n));
+		UINT8 *pDest = CpsGfx8 + (n << 1);
+
+		for (i = 0; i < 8; i++, b <<= 4)
+			pDest[i] = b >> 28;
+	}
+
+	return 0;
+}
+
+void CpstCacheExit()
+{
+	INT32 i;
+
+	BurnFree(CpsGfx8);
+
+	for (i = 0; i < 3; i++) {
+		BurnFree(CpstTileBlank[i]);
+		BurnFree(CpstTileOpaque[i]);
+	}
+}
+
+void CpstBatchBegin(INT32 nClipStart, INT32 nClipEnd)
+{
+	nCpstBatchCount = 0;
+
+	nCtvClipStart = nClipStart;
+	nCtvClipEnd = nClipEnd;
+}
+
+void CpstBatchFlush()
+{
+	struct CpstCmd *pCmd = CpstBatch;
+	struct CpstCmd *pEnd = CpstBatch + nCpstBatchCount;
+
+	while (pCmd < pEnd) {
+		struct CpstCmd *pRun = pCmd + 1;
+		INT32 nFun = (pCmd->nType & 0x7e) | (pCmd->nFlip & 1);
+
+		// Keep drawing order: only merge neighbouring tiles of the same variant
+		while (pRun < pEnd && ((pRun->nType & 0x7e) | (pRun->nFlip & 1)) == nFun)
+			pRun++;
+
+		pCtvDo[nFun](pCmd, pRun - pCmd);
+		pCmd = pRun;
+	}
+
+	nCpstBatchCount = 0;
 }
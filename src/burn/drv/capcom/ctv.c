@@ -1,6 +0,0 @@
-#include "cps.h"
-
-INT32 CtvReady()
-{
-  return 0;
-}
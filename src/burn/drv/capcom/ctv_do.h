@@ -1,13 +1,16 @@
 // CPS Tiles (header)
 
-// Draw a nxn tile
-// pCtvLine, pTile, nTileAdd are defined
+// Draw a run of nxn tiles from the tile batch
+// pCmd points to the first tile, nCount tiles all use this variant
+// Blank tiles have already been left out using CpstTileBlank
 // CU_FLIPX is 1 to flip the tile horizontally
-// CU_CARE  is 1 to clip output based on nCtvRollX/Y
-// CU_ROWS  is 1 to shift output based on CpstRowShift
+// CU_CARE  is 1 to clip output to the screen and nCtvClipStart/End
+// CU_ROWS  is 1 to shift output based on the tile's row shift table
 // CU_SIZE  is 8, 16 or 32
-// CU_BPP is 1 2 3 4 bytes per pixel
-// CU_MASK CPS1 BgHi CPS2 Sprite Masking
+// CU_BPP is 2 or 4 bytes per pixel
+// CU_MASK CPS2 Sprite Masking: 1 against ZBuf, 2 against ZBuf8
+// CU_SIMD is 1 to draw whole 8 pixel groups with the CtvSimd* helpers
+// CU_GFX8 is 1 to read tiles from the 8bpp cache (CpsGfx8) instead of CpsGfx
 
 #ifndef CU_FLIPX
  #error "CU_FLIPX wasn\'t defined"
@@ -33,53 +36,165 @@
  #error "CU_MASK wasn\'t defined"
 #endif
 
+#ifndef CU_SIMD
+ #error "CU_SIMD wasn\'t defined"
+#endif
+
+#ifndef CU_GFX8
+ #error "CU_GFX8 wasn\'t defined"
+#endif
+
+// Tile flag set and address shift for this tile size
+#if   CU_SIZE==8
+ #define CU_FLAGS 0
+ #define CU_SHIFT 6
+#elif CU_SIZE==16
+ #define CU_FLAGS 1
+ #define CU_SHIFT 7
+#else
+ #define CU_FLAGS 2
+ #define CU_SHIFT 9
+#endif
+
 {
+#if CU_CARE==1
+ INT32 nClipStart = nCtvClipStart, nClipEnd = nCtvClipEnd;	// Local copies of the clip window
+#endif
+
+ for (; nCount > 0; nCount--, pCmd++)
+ {
   INT32 y;
   UINT32 *ctp;
-  UINT32 nBlank = 0;
+  UINT32 nTile = pCmd->nTile;
 
+#if CU_GFX8==1
+  UINT8 *s;				// Eight pixels, one per byte
+  UINT32 nOpaque;		// 0xff if the tile has no transparent pixels
+#else
   UINT32 b;      			// Eight bit-packed pixels (msb) AAAABBBB CCCCDDDD EEEEFFFF GGGGHHHH (lsb)
+#endif
   UINT32 c;				// 32-bit colour value
   UINT8 *pPix;			// Pointer to output bitmap
+  UINT8 *pLine;			// Pointer to the start of the current line
+  UINT8 *pTile;			// Pointer to tile data
+  INT32 nTileAdd;		// Amount to add after each tile line
+
+#if CU_CARE==1
+  UINT32 nRollX, nRollY;	// Clip rolls: if nRollX/Y&0x20004000 both == 0, you can draw the pixel
+#endif
+
+#if CU_ROWS==1
+  INT16 *Rows = pCmd->pRows;
+#endif
+
+#if CU_MASK==1
+  UINT16 *pZVal;
+  UINT16 nZValue = pCmd->nZValue;
+#elif CU_MASK==2
+  UINT8 *pZVal;
+  UINT8 nZValue = (UINT8)pCmd->nZValue;
+#endif
+
+#if CU_SIMD==1
+ #if CU_BPP==4
+  __m128i vPal[4];			// Palette split into byte planes
+ #else
+  __m128i vPalLo, vPalHi;	// Palette split into low and high byte planes
+ #endif
+  __m128i vOpaque;
+#endif
+
+#if CU_CARE==1
+ #if CU_ROWS==0
+  // Skip if not visible at all
+  if (pCmd->nX <= -CU_SIZE) continue;
+  if (pCmd->nX >= 384)      continue;
+  if (pCmd->nY <= nClipStart - CU_SIZE) continue;
+  if (pCmd->nY >= nClipEnd) continue;
+ #endif
+  nRollX = 0x4000017f + pCmd->nX * 0x7fff;
+  nRollY = 0x40000000 + nClipEnd - nClipStart - 1 + (pCmd->nY - nClipStart) * 0x7fff;
+#endif
 
-#if CU_ROWS == 1
-  INT16 *Rows = CpstRowShift;
+  // Clip to loaded graphics data (we have a gap of 0x200 at the end)
+  nTile &= nCpsGfxMask; if (nTile >= nCpsGfxLen) continue;
+
+#if CU_GFX8==1
+  nOpaque = CPST_TILE_BIT(CpstTileOpaque[CU_FLAGS], nTile >> CU_SHIFT) ? 0xff : 0;
+  pTile = CpsGfx8 + (nTile << 1);
+#else
+  pTile = CpsGfx + nTile;
+#endif
+
+  // Find pLine (pointer to first pixel)
+  pLine = pCtvDraw + pCmd->nY * nCtvPitch + pCmd->nX * nBurnBpp;
+#if CU_MASK==1
+  pZVal = ZBuf + pCmd->nY * 384 + pCmd->nX;
+#elif CU_MASK==2
+  pZVal = ZBuf8 + pCmd->nY * 384 + pCmd->nX;
+#endif
+
+#if CU_SIZE==32
+  nTileAdd = 16 << CU_GFX8;
+#else
+  nTileAdd = 8 << CU_GFX8;
 #endif
 
-  ctp = CpstPal;
+  if (pCmd->nFlip & 2)
+  {
+    // Flip vertically
+    pTile += (CU_SIZE - 1) * nTileAdd;
+    nTileAdd = -nTileAdd;
+  }
 
-for (y = 0; y < CU_SIZE; y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
+  ctp = pCmd->pPal;
+#if CU_SIMD==1
+ #if CU_BPP==4
+  CtvSimdPal32(ctp, vPal);
+ #else
+  CtvSimdPal(ctp, &vPalLo, &vPalHi);
+ #endif
+ #if CU_GFX8==1
+  vOpaque = _mm_set1_epi8((INT8)nOpaque);
+ #else
+  vOpaque = _mm_setzero_si128();
+ #endif
+#endif
+
+for (y = 0; y < CU_SIZE; y++, pLine += nCtvPitch, pTile += nTileAdd
 
 #if CU_ROWS==1
      ,Rows++
 #endif
 
-#if CU_MASK==1
+#if CU_MASK!=0
 	 ,pZVal += 384
 #endif
 
 )
 {
 #if CU_CARE==1
-  UINT32 rx = nCtvRollX;	// Copy of nCtvRollX
+  UINT32 rx = nRollX;	// Copy of nRollX
 #endif
 
 #if CU_MASK==1
   UINT16 *pPixZ;
+#elif CU_MASK==2
+  UINT8 *pPixZ;
 #endif
 
 #if CU_CARE==1
-  if (nCtvRollY & 0x20004000) { nCtvRollY += 0x7fff; continue; } else nCtvRollY += 0x7fff;	// okay to plot line
+  if (nRollY & 0x20004000) { nRollY += 0x7fff; continue; } else nRollY += 0x7fff;	// okay to plot line
 #endif
 
   // Point to the line to draw
-  pPix = pCtvLine;
-#if CU_MASK==1
+  pPix = pLine;
+#if CU_MASK!=0
   pPixZ = pZVal;
 #endif
 
 #if CU_ROWS==1
- #if CU_MASK==1
+ #if CU_MASK!=0
   pPixZ += Rows[0];
  #endif
   pPix += Rows[0] * nBurnBpp;
@@ -90,72 +205,100 @@ for (y = 0; y < CU_SIZE; y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
 
 // Make macros for plotting c and advancing pPix by one pixel
 #if CU_BPP==2
- #if   CU_MASK==1
-  #define PLOT { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } }
+ #if   CU_MASK!=0
+  #define PLOT { if(*pPixZ < nZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=nZValue; } }
   #define ADV { pPix+=2; pPixZ++; }
  #else
   #define PLOT { *((UINT16 *)pPix)=(UINT16)c; }
   #define ADV pPix+=2
  #endif
+#elif CU_BPP==4
+ #if   CU_MASK!=0
+  #define PLOT { if(*pPixZ < nZValue) { *((UINT32 *)pPix)=c; *pPixZ=nZValue; } }
+  #define ADV { pPix+=4; pPixZ++; }
+ #else
+  #define PLOT { *((UINT32 *)pPix)=c; }
+  #define ADV pPix+=4
+ #endif
 #else
  #error Unsupported CU_BPP
 #endif
 
-// Make macros for plotting the next pixel from 'b' (= 8 packed pixels)
-// or skipping the pixel.
-#if CU_FLIPX==0
- #define NEXTPIXEL ADV; b <<= 4;
- #if CU_MASK==2
-  #define DRAWPIXEL { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; PLOT } }
+// Make macros for loading the group of 8 pixels at packed tile offset x,
+// plotting the next pixel from it or skipping the pixel.
+#if CU_GFX8==1
+ #if CU_FLIPX==0
+  #define LOAD_8(x) s = pTile + ((x) << 1);
+  #define NEXTPIXEL ADV; s++;
  #else
-  #define DRAWPIXEL { if (b & 0xf0000000) { c = ctp[b >> 28]; PLOT } }
+  #define LOAD_8(x) s = pTile + ((x) << 1) + 7;
+  #define NEXTPIXEL ADV; s--;
  #endif
+ #define DRAWPIXEL { if (*s | nOpaque) { c = ctp[*s]; PLOT } }
+ #define SIMD_INDEX CtvSimdIndex8(s - 7 * CU_FLIPX, CU_FLIPX)
 #else
- #define NEXTPIXEL ADV; b >>= 4;
- #if CU_MASK==2
-  #define DRAWPIXEL { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; PLOT } }
+ #define LOAD_8(x) b = *((UINT32 *)(pTile + (x)));
+ #if CU_FLIPX==0
+  #define NEXTPIXEL ADV; b <<= 4;
+  #define DRAWPIXEL { if (b & 0xf0000000) { c = ctp[b >> 28]; PLOT } }
  #else
+  #define NEXTPIXEL ADV; b >>= 4;
   #define DRAWPIXEL { if (b & 0x0000000f) { c = ctp[b & 15]; PLOT } }
  #endif
+ #define SIMD_INDEX CtvSimdIndex(b, CU_FLIPX)
 #endif
 
 #define EIGHT(x) x x x x x x x x
 
 #if CU_CARE==1
- // If we need to clip left or right, check nCtvRollX before plotting
+ // If we need to clip left or right, check rx before plotting
  #define DO_PIX if ((rx & 0x20004000) == 0) DRAWPIXEL NEXTPIXEL rx += 0x7fff;
 #else
  // Always plot
  #define DO_PIX DRAWPIXEL NEXTPIXEL
 #endif
 
-#define DRAW_8 nBlank |= b; EIGHT(DO_PIX)
+#if CU_SIMD==1
+ #if CU_BPP==4 && CU_MASK==1
+  #define DRAW_SIMD { CtvSimdRow32Z((UINT32 *)pPix, pPixZ, SIMD_INDEX, vPal, vOpaque, nZValue); pPix += 32; pPixZ += 8; }
+ #elif CU_BPP==4 && CU_MASK==2
+  #define DRAW_SIMD { CtvSimdRow32Z8((UINT32 *)pPix, pPixZ, SIMD_INDEX, vPal, vOpaque, nZValue); pPix += 32; pPixZ += 8; }
+ #elif CU_BPP==4
+  #define DRAW_SIMD { CtvSimdRow32((UINT32 *)pPix, SIMD_INDEX, vPal, vOpaque); pPix += 32; }
+ #elif CU_MASK==1
+  #define DRAW_SIMD { CtvSimdRowZ((UINT16 *)pPix, pPixZ, SIMD_INDEX, vPalLo, vPalHi, vOpaque, nZValue); pPix += 16; pPixZ += 8; }
+ #elif CU_MASK==2
+  #define DRAW_SIMD { CtvSimdRowZ8((UINT16 *)pPix, pPixZ, SIMD_INDEX, vPalLo, vPalHi, vOpaque, nZValue); pPix += 16; pPixZ += 8; }
+ #else
+  #define DRAW_SIMD { CtvSimdRow((UINT16 *)pPix, SIMD_INDEX, vPalLo, vPalHi, vOpaque); pPix += 16; }
+ #endif
+ #if CU_CARE==1
+  // Only whole groups can go through the vector path, clip the edges pixel by pixel
+  #define DRAW_8(x) LOAD_8(x) if (((rx | (rx + 7 * 0x7fff)) & 0x20004000) == 0) { DRAW_SIMD rx += 8 * 0x7fff; } else { EIGHT(DO_PIX) }
+ #else
+  #define DRAW_8(x) LOAD_8(x) DRAW_SIMD
+ #endif
+#else
+ #define DRAW_8(x) LOAD_8(x) EIGHT(DO_PIX)
+#endif
 
 #if   CU_SIZE==8
   // 8x8 tiles
-  b=*((UINT32 *)(pCtvTile+0)); DRAW_8
+  DRAW_8(0)
 #elif CU_SIZE==16
  // 16x16 tiles
  #if CU_FLIPX==0
-  b=*((UINT32 *)(pCtvTile+0)); DRAW_8
-  b=*((UINT32 *)(pCtvTile+4)); DRAW_8
+  DRAW_8(0) DRAW_8(4)
  #else
-  b=*((UINT32 *)(pCtvTile+4)); DRAW_8
-  b=*((UINT32 *)(pCtvTile+0)); DRAW_8
+  DRAW_8(4) DRAW_8(0)
  #endif
 
 #elif CU_SIZE==32
  // 32x32 tiles
  #if CU_FLIPX==0
-  b=*((UINT32 *)(pCtvTile+ 0)); DRAW_8
-  b=*((UINT32 *)(pCtvTile+ 4)); DRAW_8
-  b=*((UINT32 *)(pCtvTile+ 8)); DRAW_8
-  b=*((UINT32 *)(pCtvTile+12)); DRAW_8
+  DRAW_8(0) DRAW_8(4) DRAW_8(8) DRAW_8(12)
  #else
-  b=*((UINT32 *)(pCtvTile+12)); DRAW_8
-  b=*((UINT32 *)(pCtvTile+ 8)); DRAW_8
-  b=*((UINT32 *)(pCtvTile+ 4)); DRAW_8
-  b=*((UINT32 *)(pCtvTile+ 0)); DRAW_8
+  DRAW_8(12) DRAW_8(8) DRAW_8(4) DRAW_8(0)
  #endif
 
 #else
@@ -163,14 +306,19 @@ for (y = 0; y < CU_SIZE; y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
 #endif
 
 #undef DRAW_8
+#undef DRAW_SIMD
 #undef DO_PIX
 #undef EIGHT
+#undef SIMD_INDEX
 #undef DRAWPIXEL
 #undef NEXTPIXEL
+#undef LOAD_8
 
 #undef ADV
 #undef PLOT
 }
-
-  return nBlank == 0;
+ }
 }
+
+#undef CU_SHIFT
+#undef CU_FLAGS
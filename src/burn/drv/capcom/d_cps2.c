@@ -4,6 +4,8 @@
 
 INT32 Cps2Volume = 39;
 INT32 Cps2DisableDigitalVolume = 0;
+INT32 Cps2IdleSkip = 1;							// Skip the 68000's idle loops (set by the application)
+INT32 Cps2ZIdleSkip = 0;						// Skip the QSound Z80's idle loops (set by the application)
 UINT8 Cps2VolUp;
 UINT8 Cps2VolDwn;
 
@@ -76,7 +76,9 @@ void QsndNewFrame()
 
 void QsndEndFrame(void)
 {
+	BURN_PROF_ENTER(BURN_PROF_QSND_Z80);
 	BurnTimerEndFrame(nCpsZ80Cycles);
+	BURN_PROF_LEAVE();
 	if (pBurnSoundOut) QscUpdate(nBurnSoundLen);
 
 	nQsndCyclesExtra = ZetTotalCycles() - nCpsZ80Cycles;
@@ -90,5 +92,7 @@ void QsndSyncZ80()
    if (nCycles <= ZetTotalCycles())
       return;
 
+   BURN_PROF_ENTER(BURN_PROF_QSND_Z80);
    BurnTimerUpdate(nCycles);
+   BURN_PROF_LEAVE();
 }
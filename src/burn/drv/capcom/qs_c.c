@@ -4,6 +4,12 @@
 #include "cps.h"
 #include "burn_sound.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 static const INT32 nQscClock = 4000000;
 static const INT32 nQscClockDivider = 166;
 
@@ -14,6 +20,30 @@ static INT32* Qs_s = NULL;
 
 static INT32 nPos;
 
+static UINT32 nQscActive = 0;			// Bit set for each channel with bKey set
+INT32 bQscFrameSilent = 0;				// Set if all of this frame's output was silence
+
+// With bQscNativeRate, the channels are mixed at the chip's own rate
+// (nQscClock / nQscClockDivider, about 24kHz) with linear interpolation, and
+// the mix is brought to nQscRate by one polyphase FIR filter.
+INT32 bQscNativeRate = 0;				// Set by the application
+static INT32 nQscNative = 0;			// bQscNativeRate when QscInit was called
+
+#ifndef M_PI
+ #define M_PI		(3.14159265358979323846)
+#endif
+
+#define QSC_TAPS	(16)				// Taps per filter phase
+#define QSC_PHASES	(256)				// Filter phases between two native samples
+
+static INT16 QscLinear[4096 * 4];		// Linear interpolation as 4 tap coefficients, like Precalc
+static float QscFilter[QSC_PHASES][QSC_TAPS];
+static float* QscHist[2] = { NULL, NULL };	// Native samples (left and right) not yet used up
+static INT32 nQscHistLen = 0;			// Size of QscHist
+static INT32 nQscHistCount = 0;			// Native samples in QscHist
+static INT32 nQscHistAcc = 0;			// Time since QscHist[0], in 1 / (nQscClockDivider * nQscRate) seconds
+static INT32 nQscHistSilent = 0;		// Silent native samples at the end of QscHist
+
 struct QChan
 {
    UINT8 bKey;				// 1 if channel is playing
@@ -88,10 +118,61 @@ static void UpdateEndBuffer(struct QChan* pc)
 
 static void CalcAdvance(struct QChan* pc)
 {
-	if (nQscRate)
+	if (nQscNative)
+		pc->nAdvance = pc->nPitch;
+	else if (nQscRate)
 		pc->nAdvance = (INT64)pc->nPitch * nQscClock / nQscClockDivider / nQscRate;
 }
 
+// Windowed sinc low pass at the lower of the two Nyquist frequencies, one set of taps for each phase
+static void QscFilterInit()
+{
+	double fc = 0.45 * nQscRate * nQscClockDivider / nQscClock;	// Cut off, in cycles per native sample
+	INT32 i, j;
+
+	if (fc > 0.45)
+		fc = 0.45;
+
+	for (i = 0; i < QSC_PHASES; i++) {
+		double nSum = 0.0, h[QSC_TAPS];
+
+		for (j = 0; j < QSC_TAPS; j++) {
+			double x = j - (QSC_TAPS / 2 - 1) - (double)i / QSC_PHASES;
+			double w = 2.0 * M_PI * (x + QSC_TAPS / 2) / QSC_TAPS;
+
+			h[j] = (x == 0.0) ? 2.0 * fc : sin(2.0 * M_PI * fc * x) / (M_PI * x);
+			h[j] *= 0.42 - 0.5 * cos(w) + 0.08 * cos(2.0 * w);		// Blackman window
+			nSum += h[j];
+		}
+
+		// Unity gain at DC for every phase
+		for (j = 0; j < QSC_TAPS; j++)
+			QscFilter[i][j] = (float)(h[j] / nSum);
+	}
+
+	for (i = 0; i < 4096; i++) {
+		QscLinear[i * 4 + 0] = 0;
+		QscLinear[i * 4 + 1] = (INT16)(16384 - i * 4);
+		QscLinear[i * 4 + 2] = (INT16)(i * 4);
+		QscLinear[i * 4 + 3] = 0;
+	}
+}
+
+// Start with a filter's worth of silence, so each native sample is
+// mixed at about the time it is output
+static void QscResetHist(void)
+{
+	INT32 i;
+
+	nQscHistCount = QSC_TAPS - 1;
+	nQscHistSilent = nQscHistCount;
+	nQscHistAcc = 0;
+	for (i = 0; i < 2; i++) {
+		if (QscHist[i])
+			memset(QscHist[i], 0, nQscHistCount * sizeof(float));
+	}
+}
+
 void QscReset()
 {
    INT32 i;
@@ -100,6 +181,9 @@ void QscReset()
 	// Point all to bank 0
 	for (i = 0; i < 16; i++)
 		QChan[i].PlayBank = (INT8*)CpsQSam;
+	nQscActive = 0;
+
+	QscResetHist();
 }
 
 void QscExit()
@@ -108,12 +192,20 @@ void QscExit()
 
 	BurnFree(Qs_s);
 	Tams = -1;
+
+	BurnFree(QscHist[0]);
+	BurnFree(QscHist[1]);
+	nQscHistLen = 0;
 }
 
 INT32 QscInit(INT32 nRate)
 {
    INT32 i;
 	nQscRate = nRate;
+	nQscNative = bQscNativeRate && nRate > 0;
+
+	if (nQscNative)
+		QscFilterInit();
 
 	for (i = 0; i < 33; i++)
 		PanningVolumes[i] = (INT32)((256.0 / sqrt(32.0)) * sqrt((double)i));
@@ -142,11 +234,17 @@ INT32 QscScan(INT32 nAction)
    {
       INT32 i;
 		// Update bank pointers with new banks, and recalc nAdvance
+		nQscActive = 0;
 		for (i = 0; i < 16; i++)
       {
 			MapBank(QChan + i);
 			CalcAdvance(QChan + i);
+			if (QChan[i].bKey)
+				nQscActive |= 1 << i;
 		}
+
+		// Don't play the samples from before the state was loaded
+		QscResetHist();
 	}
 
 	return 0;
@@ -155,6 +253,7 @@ INT32 QscScan(INT32 nAction)
 void QscNewFrame(void)
 {
 	nPos = 0;
+	bQscFrameSilent = 1;
 }
 
 static INLINE void QscSyncQsnd(void)
@@ -216,7 +315,10 @@ void QscWrite(INT32 a, INT32 d)
          CalcAdvance(pc);
 
          if (d == 0)	// Key off; stop playing
+         {
             pc->bKey = 0;
+            nQscActive &= ~(1 << nChanNum);
+         }
 
          break;
 #if 0
@@ -236,7 +338,10 @@ void QscWrite(INT32 a, INT32 d)
                  pc->nMasterVolume = d;
 
                  if (d == 0)
+                 {
                     pc->bKey = 0;
+                    nQscActive &= ~(1 << nChanNum);
+                 }
                  else
                  {
                     // Key on; play sample
@@ -246,6 +351,7 @@ void QscWrite(INT32 a, INT32 d)
 
                        pc->nPos = 0;
                        pc->bKey = 3;
+                       nQscActive |= 1 << nChanNum;
                        UpdateEndBuffer(pc);
                     }
                  }
@@ -260,34 +366,127 @@ void QscWrite(INT32 a, INT32 d)
    }
 }
 
-static INT32 QscUpdate_Accum(INT32 p, INT32 c)
+// Interpolation of the sample at position nPos (16.12) in the bank, Coef is
+// Precalc (cubic) or QscLinear
+static INLINE INT32 QscInterp(INT8* PlayBank, INT32 nPos, INT16* Coef)
 {
-   INT32 fp = (QChan[c].nPos) & ((1 << 12) - 1);
-   INT32 sN = QChan[c].PlayBank[p + 0];
-   INT32 s0 = QChan[c].PlayBank[p + 1];
-   INT32 s1 = QChan[c].PlayBank[p + 2];
-   INT32 s2 = QChan[c].PlayBank[p + 3];
-   INT32  v = 256;
-   INT32  s = sN * (INT32)*((volatile INT16*)(Precalc + (fp * 4 + 0)));
-   s       += s0 * (INT32)*((volatile INT16*)(Precalc + (fp * 4 + 1)));
-   s       += s1 * (INT32)*((volatile INT16*)(Precalc + (fp * 4 + 2)));
-   s       += s2 * (INT32)*((volatile INT16*)(Precalc + (fp * 4 + 3)));
-   return s / v;
+   INT32 p  = (nPos >> 12) & 0xFFFF;
+   INT16* c = Coef + ((nPos & 0x0FFF) << 2);
+   INT32 s  = PlayBank[p + 0] * c[0] + PlayBank[p + 1] * c[1] + PlayBank[p + 2] * c[2] + PlayBank[p + 3] * c[3];
+   return s / 256;
 }
 
-INT32 QscUpdate(INT32 nEnd)
+// Mix nCount samples of a channel which won't reach the end of its sample
+static void QscMixRun(struct QChan* pc, INT32* pTemp, INT32 nCount, INT32 VolL, INT32 VolR, INT16* Coef)
 {
-   INT32 nLen, c, i;
-   INT16 *pDest;
-   INT32 *pSrc;
+   INT8* PlayBank = pc->PlayBank;
+   INT32 nPos     = pc->nPos;
+   INT32 nAdvance = pc->nAdvance;
 
-   if (nEnd > nBurnSoundLen)
-      nEnd = nBurnSoundLen;
+   // Nothing to hear, only move on
+   if (VolL == 0 && VolR == 0)
+   {
+      pc->nPos = nPos + nCount * nAdvance;
+      return;
+   }
 
-   nLen = nEnd - nPos;
+#if defined(__SSE2__)
+   // Four samples at a time. The interpolated samples and the volumes both
+   // fit in 16 bits, so _mm_madd_epi16 can do the 32 bit multiplies.
+   __m128i vVolL = _mm_set1_epi32(VolL);
+   __m128i vVolR = _mm_set1_epi32(VolR);
+   __m128i vRound = _mm_set1_epi32(255);
 
-   if (nLen <= 0)
-      return 0;
+   for (; nCount >= 4; nCount -= 4, pTemp += 8, nPos += nAdvance << 2)
+   {
+      INT32 p0 = nPos, p1 = p0 + nAdvance, p2 = p1 + nAdvance, p3 = p2 + nAdvance;
+      INT32 w0, w1, w2, w3;
+      __m128i vTaps, vLo, vHi, vSum, vOdd;
+
+      // Four taps for each sample, sign extended to 16 bits
+      memcpy(&w0, PlayBank + ((p0 >> 12) & 0xFFFF), 4);
+      memcpy(&w1, PlayBank + ((p1 >> 12) & 0xFFFF), 4);
+      memcpy(&w2, PlayBank + ((p2 >> 12) & 0xFFFF), 4);
+      memcpy(&w3, PlayBank + ((p3 >> 12) & 0xFFFF), 4);
+      vTaps = _mm_setr_epi32(w0, w1, w2, w3);
+      vLo = _mm_srai_epi16(_mm_unpacklo_epi8(vTaps, vTaps), 8);
+      vHi = _mm_srai_epi16(_mm_unpackhi_epi8(vTaps, vTaps), 8);
+
+      // Times the coefficients, in pairs of taps
+      vLo = _mm_madd_epi16(vLo, _mm_unpacklo_epi64(_mm_loadl_epi64((__m128i*)(Coef + ((p0 & 0x0FFF) << 2))), _mm_loadl_epi64((__m128i*)(Coef + ((p1 & 0x0FFF) << 2)))));
+      vHi = _mm_madd_epi16(vHi, _mm_unpacklo_epi64(_mm_loadl_epi64((__m128i*)(Coef + ((p2 & 0x0FFF) << 2))), _mm_loadl_epi64((__m128i*)(Coef + ((p3 & 0x0FFF) << 2)))));
+      vSum = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(vLo), _mm_castsi128_ps(vHi), _MM_SHUFFLE(2, 0, 2, 0)));
+      vOdd = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(vLo), _mm_castsi128_ps(vHi), _MM_SHUFFLE(3, 1, 3, 1)));
+      vSum = _mm_add_epi32(vSum, vOdd);
+
+      // s / 256, rounding towards zero like the scalar code
+      vSum = _mm_srai_epi32(_mm_add_epi32(vSum, _mm_and_si128(_mm_srai_epi32(vSum, 31), vRound)), 8);
+
+      vLo = _mm_madd_epi16(vSum, vVolL);
+      vHi = _mm_madd_epi16(vSum, vVolR);
+      _mm_storeu_si128((__m128i*)(pTemp + 0), _mm_add_epi32(_mm_loadu_si128((__m128i*)(pTemp + 0)), _mm_unpacklo_epi32(vLo, vHi)));
+      _mm_storeu_si128((__m128i*)(pTemp + 4), _mm_add_epi32(_mm_loadu_si128((__m128i*)(pTemp + 4)), _mm_unpackhi_epi32(vLo, vHi)));
+   }
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+   // Four samples at a time, the same sums as the scalar code
+   int32x4_t vVolL = vdupq_n_s32(VolL);
+   int32x4_t vVolR = vdupq_n_s32(VolR);
+   int32x4_t vRound = vdupq_n_s32(255);
+
+   for (; nCount >= 4; nCount -= 4, pTemp += 8, nPos += nAdvance << 2)
+   {
+      INT32 p0 = nPos, p1 = p0 + nAdvance, p2 = p1 + nAdvance, p3 = p2 + nAdvance;
+      INT32 w[4];
+      int8x16_t vTaps;
+      int16x8_t vLo, vHi, vCoefLo, vCoefHi;
+      int32x4_t v0, v1, v2, v3, vSum;
+      int32x4x2_t vOut;
+
+      // Four taps for each sample, sign extended to 16 bits
+      memcpy(&w[0], PlayBank + ((p0 >> 12) & 0xFFFF), 4);
+      memcpy(&w[1], PlayBank + ((p1 >> 12) & 0xFFFF), 4);
+      memcpy(&w[2], PlayBank + ((p2 >> 12) & 0xFFFF), 4);
+      memcpy(&w[3], PlayBank + ((p3 >> 12) & 0xFFFF), 4);
+      vTaps = vreinterpretq_s8_s32(vld1q_s32(w));
+      vLo = vmovl_s8(vget_low_s8(vTaps));
+      vHi = vmovl_s8(vget_high_s8(vTaps));
+
+      // Times the coefficients, then the four products of each sample added up
+      vCoefLo = vcombine_s16(vld1_s16(Coef + ((p0 & 0x0FFF) << 2)), vld1_s16(Coef + ((p1 & 0x0FFF) << 2)));
+      vCoefHi = vcombine_s16(vld1_s16(Coef + ((p2 & 0x0FFF) << 2)), vld1_s16(Coef + ((p3 & 0x0FFF) << 2)));
+      v0 = vmull_s16(vget_low_s16(vLo), vget_low_s16(vCoefLo));
+      v1 = vmull_s16(vget_high_s16(vLo), vget_high_s16(vCoefLo));
+      v2 = vmull_s16(vget_low_s16(vHi), vget_low_s16(vCoefHi));
+      v3 = vmull_s16(vget_high_s16(vHi), vget_high_s16(vCoefHi));
+      vSum = vcombine_s32(
+            vpadd_s32(vpadd_s32(vget_low_s32(v0), vget_high_s32(v0)), vpadd_s32(vget_low_s32(v1), vget_high_s32(v1))),
+            vpadd_s32(vpadd_s32(vget_low_s32(v2), vget_high_s32(v2)), vpadd_s32(vget_low_s32(v3), vget_high_s32(v3))));
+
+      // s / 256, rounding towards zero like the scalar code
+      vSum = vshrq_n_s32(vaddq_s32(vSum, vandq_s32(vshrq_n_s32(vSum, 31), vRound)), 8);
+
+      vOut = vzipq_s32(vmulq_s32(vSum, vVolL), vmulq_s32(vSum, vVolR));
+      vst1q_s32(pTemp + 0, vaddq_s32(vld1q_s32(pTemp + 0), vOut.val[0]));
+      vst1q_s32(pTemp + 4, vaddq_s32(vld1q_s32(pTemp + 4), vOut.val[1]));
+   }
+#endif
+
+   for (; nCount > 0; nCount--, pTemp += 2, nPos += nAdvance)
+   {
+      INT32 s = QscInterp(PlayBank, nPos, Coef);
+
+      pTemp[0] += s * VolL;
+      pTemp[1] += s * VolR;
+   }
+
+   pc->nPos = nPos;
+}
+
+// Mix nLen samples of all the channels into Qs_s
+static void QscMix(INT32 nLen)
+{
+   INT16* Coef = nQscNative ? QscLinear : Precalc;
+   INT32 c, i;
 
    if (Tams < nLen)
    {
@@ -302,7 +501,7 @@ INT32 QscUpdate(INT32 nEnd)
    for (c = 0; c < 16; c++)
    {
       // If the channel is playing, add the samples to the buffer
-      if (QChan[c].bKey)
+      if (nQscActive & (1 << c))
       {
          INT32 VolL   = (QChan[c].nMasterVolume * QChan[c].nVolume[0]) >> 11;
          INT32 VolR   = (QChan[c].nMasterVolume * QChan[c].nVolume[1]) >> 11;
@@ -341,44 +540,52 @@ INT32 QscUpdate(INT32 nEnd)
 
          while (i > 0)
          {
-            INT32 s, p;
+            INT32 s;
+
+            // Mix up to the last 3 samples in one run
+            if (QChan[c].nPos < (QChan[c].nEnd - 0x3000))
+            {
+               INT32 nRun = i;
+
+               if (QChan[c].nAdvance > 0 && (QChan[c].nEnd - 0x3000 - QChan[c].nPos) / QChan[c].nAdvance < i)
+                  nRun = (QChan[c].nEnd - 0x3000 - QChan[c].nPos + QChan[c].nAdvance - 1) / QChan[c].nAdvance;
+
+               QscMixRun(QChan + c, pTemp, nRun, VolL, VolR, Coef);
+
+               pTemp += nRun << 1;
+               i     -= nRun;
+               continue;
+            }
 
             // Check for end of sample
-            if (QChan[c].nPos >= (QChan[c].nEnd - 0x3000))
+            if (QChan[c].nPos < QChan[c].nEnd)
             {
-               if (QChan[c].nPos < QChan[c].nEnd)
-               {
-                  INT32 nIndex = 4 - ((QChan[c].nEnd - QChan[c].nPos) >> 12);
-                  s = INTERPOLATE4PS_CUSTOM((QChan[c].nPos) & ((1 << 12) - 1),
-                        QChan[c].nEndBuffer[nIndex + 0],
-                        QChan[c].nEndBuffer[nIndex + 1],
-                        QChan[c].nEndBuffer[nIndex + 2],
-                        QChan[c].nEndBuffer[nIndex + 3],
-                        256);
+               INT32 nIndex = 4 - ((QChan[c].nEnd - QChan[c].nPos) >> 12);
+               s = INTERPOLATE4PS_CUSTOM((QChan[c].nPos) & ((1 << 12) - 1),
+                     QChan[c].nEndBuffer[nIndex + 0],
+                     QChan[c].nEndBuffer[nIndex + 1],
+                     QChan[c].nEndBuffer[nIndex + 2],
+                     QChan[c].nEndBuffer[nIndex + 3],
+                     256);
+            }
+            else
+            {
+               if (QChan[c].nLoop)
+               {					// Loop sample
+                  if (QChan[c].nLoop <= 0x1000) {		// Don't play, but leave bKey on
+                     QChan[c].nPos = QChan[c].nEnd - 0x1000;
+                     break;
+                  }
+                  QChan[c].nPos -= QChan[c].nLoop;
+                  continue;
                }
                else
                {
-                  if (QChan[c].nLoop)
-                  {					// Loop sample
-                     if (QChan[c].nLoop <= 0x1000) {		// Don't play, but leave bKey on
-                        QChan[c].nPos = QChan[c].nEnd - 0x1000;
-                        break;
-                     }
-                     QChan[c].nPos -= QChan[c].nLoop;
-                     continue;
-                  }
-                  else
-                  {
-                     QChan[c].bKey = 0;					// Stop playing
-                     break;
-                  }
+                  QChan[c].bKey = 0;					// Stop playing
+                  nQscActive &= ~(1 << c);
+                  break;
                }
             }
-            else
-            {
-               p  = (QChan[c].nPos >> 12) & 0xFFFF;
-               s  = QscUpdate_Accum(p, c);
-            }
 
             // Add to the sound currently in the buffer
             pTemp[0]      += s * VolL;
@@ -393,18 +600,171 @@ INT32 QscUpdate(INT32 nEnd)
       }
    }
 
-   pDest = pBurnSoundOut + (nPos << 1);
-   pSrc  = Qs_s;
+}
+
+// Mix at the native rate as far as needed, and resample nLen output samples to pDest
+static void QscUpdateNative(INT16* pDest, INT32 nLen)
+{
+   INT32 nStep = nQscClock;							// Per output sample
+   INT32 nDen  = nQscClockDivider * nQscRate;		// Per native sample
+   INT32 nNeed = (INT32)((nQscHistAcc + (INT64)(nLen - 1) * nStep) / nDen) + QSC_TAPS;
+   INT32 nAcc  = nQscHistAcc;
+   INT32 nUsed = 0;
+   INT32 i;
+
+   if (nNeed > nQscHistLen)
+   {
+      for (i = 0; i < 2; i++)
+      {
+         float* pNew = (float*)BurnMalloc(nNeed * sizeof(float));	// Zeroed, the silence from QscReset
+         if (QscHist[i])
+            memcpy(pNew, QscHist[i], nQscHistCount * sizeof(float));
+         BurnFree(QscHist[i]);
+         QscHist[i] = pNew;
+      }
+      nQscHistLen = nNeed;
+   }
+
+   if (nNeed > nQscHistCount)
+   {
+      INT32 nNew = nNeed - nQscHistCount;
+
+      if (nQscActive == 0)
+      {
+         for (i = 0; i < 2; i++)
+            memset(QscHist[i] + nQscHistCount, 0, nNew * sizeof(float));
+         nQscHistSilent += nNew;
+      }
+      else
+      {
+         QscMix(nNew);
+         for (i = 0; i < nNew; i++)
+         {
+            QscHist[0][nQscHistCount + i] = (float)(Qs_s[(i << 1) + 0] >> 8);
+            QscHist[1][nQscHistCount + i] = (float)(Qs_s[(i << 1) + 1] >> 8);
+         }
+
+         for (i = nNew; i > 0 && (Qs_s[(i << 1) - 2] >> 8) == 0 && (Qs_s[(i << 1) - 1] >> 8) == 0; i--) ;
+         nQscHistSilent = (i == 0) ? nQscHistSilent + nNew : nNew - i;
+      }
+      nQscHistCount = nNeed;
+   }
+
+   // Every tap silent: the output is too
+   if (nQscHistSilent >= nQscHistCount)
+   {
+      INT64 nTime = nAcc + (INT64)nLen * nStep;
+
+      memset(pDest, 0, nLen * 2 * sizeof(INT16));
+      nUsed = (INT32)(nTime / nDen);
+      nAcc  = (INT32)(nTime % nDen);
+      nLen  = 0;
+   }
+   else
+   {
+      bQscFrameSilent = 0;
+   }
 
    for (i = 0; i < nLen; i++)
    {
-      INT32 nLeftSample   = (INT32)((pSrc[(i << 1) + 0] >> 8) * QsndGain[BURN_SND_QSND_OUTPUT_1]);
-      INT32 nRightSample  = (INT32)((pSrc[(i << 1) + 1] >> 8) * QsndGain[BURN_SND_QSND_OUTPUT_2]);
+      float* h  = QscFilter[(INT64)nAcc * QSC_PHASES / nDen];
+      float* hL = QscHist[0] + nUsed;
+      float* hR = QscHist[1] + nUsed;
+      float fLeft, fRight;
+      INT32 nLeftSample, nRightSample, j;
+
+#if defined(__SSE2__)
+      __m128 vL = _mm_setzero_ps(), vR = _mm_setzero_ps(), vSum;
+
+      for (j = 0; j < QSC_TAPS; j += 4)
+      {
+         __m128 vH = _mm_loadu_ps(h + j);
+         vL = _mm_add_ps(vL, _mm_mul_ps(vH, _mm_loadu_ps(hL + j)));
+         vR = _mm_add_ps(vR, _mm_mul_ps(vH, _mm_loadu_ps(hR + j)));
+      }
+
+      // Sum the four lanes of both sides
+      vSum = _mm_add_ps(_mm_unpacklo_ps(vL, vR), _mm_unpackhi_ps(vL, vR));
+      vSum = _mm_add_ps(vSum, _mm_movehl_ps(vSum, vSum));
+      fLeft  = _mm_cvtss_f32(vSum);
+      fRight = _mm_cvtss_f32(_mm_shuffle_ps(vSum, vSum, _MM_SHUFFLE(1, 1, 1, 1)));
+#else
+      fLeft = fRight = 0.0f;
+      for (j = 0; j < QSC_TAPS; j++)
+      {
+         fLeft  += h[j] * hL[j];
+         fRight += h[j] * hR[j];
+      }
+#endif
+
+      nLeftSample  = (INT32)(fLeft  * QsndGain[BURN_SND_QSND_OUTPUT_1]);
+      nRightSample = (INT32)(fRight * QsndGain[BURN_SND_QSND_OUTPUT_2]);
 
       pDest[(i << 1) + 0] = BURN_SND_CLIP(nLeftSample);
       pDest[(i << 1) + 1] = BURN_SND_CLIP(nRightSample);
+
+      nAcc += nStep;
+      while (nAcc >= nDen)
+      {
+         nAcc -= nDen;
+         nUsed++;
+      }
+   }
+
+   // Keep the native samples the next outputs still need
+   for (i = 0; i < 2; i++)
+      memmove(QscHist[i], QscHist[i] + nUsed, (nQscHistCount - nUsed) * sizeof(float));
+   nQscHistCount -= nUsed;
+   nQscHistAcc = nAcc;
+   if (nQscHistSilent > nQscHistCount)
+      nQscHistSilent = nQscHistCount;
+}
+
+INT32 QscUpdate(INT32 nEnd)
+{
+   INT32 nLen, i;
+   INT16 *pDest;
+   INT32 *pSrc;
+
+   if (nEnd > nBurnSoundLen)
+      nEnd = nBurnSoundLen;
+
+   nLen = nEnd - nPos;
+
+   if (nLen <= 0)
+      return 0;
+
+   BURN_PROF_ENTER(BURN_PROF_QSC);
+
+   pDest = pBurnSoundOut + (nPos << 1);
+
+   if (nQscNative)
+   {
+      QscUpdateNative(pDest, nLen);
+   }
+   else if (nQscActive == 0)
+   {
+      memset(pDest, 0, nLen * 2 * sizeof(INT16));
+   }
+   else
+   {
+      bQscFrameSilent = 0;
+
+      QscMix(nLen);
+      pSrc = Qs_s;
+
+      for (i = 0; i < nLen; i++)
+      {
+         INT32 nLeftSample   = (INT32)((pSrc[(i << 1) + 0] >> 8) * QsndGain[BURN_SND_QSND_OUTPUT_1]);
+         INT32 nRightSample  = (INT32)((pSrc[(i << 1) + 1] >> 8) * QsndGain[BURN_SND_QSND_OUTPUT_2]);
+
+         pDest[(i << 1) + 0] = BURN_SND_CLIP(nLeftSample);
+         pDest[(i << 1) + 1] = BURN_SND_CLIP(nRightSample);
+      }
    }
    nPos = nEnd;	
 
+   BURN_PROF_LEAVE();
+
    return 0;
 }
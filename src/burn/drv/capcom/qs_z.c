@@ -66,6 +66,9 @@ INT32 QsndZInit(void)
    ZetInit(0);
    ZetOpen(0);
 
+   // The 68000 only changes the shared RAM between the Z80's timeslices
+   ZetSetIdleSkip(Cps2ZIdleSkip != 0);
+
    ZetSetReadHandler(QsndZRead);
    ZetSetWriteHandler(QsndZWrite);
 
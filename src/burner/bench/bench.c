@@ -0,0 +1,522 @@
+/* Headless benchmark frontend
+ *
+ * Drives the libretro core directly (retro_load_game -> open_archive ->
+ * BurnDrvInit) without any video, audio or input backend, runs a fixed number
+ * of frames and reports the throughput plus the time spent in each profiled
+ * subsystem.
+ *
+ * Input scripts are plain text, one event per line:
+ *
+ *    <frame> <port> <buttons>
+ *
+ * <buttons> is "none" or a '+' separated list of RetroPad buttons
+ * (b, y, select, start, up, down, left, right, a, x, l, r, l2, r2, l3, r3).
+ * The buttons are held on that port from <frame> until the next event for
+ * the same port.  '#' starts a comment.
+ *
+ * With -H the CRC32 of every video frame and audio batch is written to a
+ * file, one "<frame> <video> <audio>" line per frame; -c compares a run
+ * against such a file and fails on the first differing frame.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+#include <unistd.h>
+#include <dirent.h>
+
+#include "libretro.h"
+#include "burner.h"
+#include "zlib.h"
+
+#define BENCH_MAX_PORTS    4
+#define BENCH_MAX_OPTIONS  32
+
+struct bench_event
+{
+   unsigned frame;
+   unsigned port;
+   uint16_t buttons;
+};
+
+static struct bench_event *events;
+static unsigned event_count;
+static unsigned event_next;
+static uint16_t port_state[BENCH_MAX_PORTS];
+
+static char option_keys[BENCH_MAX_OPTIONS][128];
+static char option_values[BENCH_MAX_OPTIONS][128];
+static unsigned option_count;
+
+static char save_dir[256];
+static bool verbose;
+static unsigned frame_current;
+
+static FILE *hash_fp;
+static bool hash_write;
+static unsigned mismatch;
+static uint32_t video_crc;
+static unsigned video_bpp = 2; /* Bytes per pixel of the pixel format the core set */
+static uint32_t audio_crc;
+
+static const char *button_names[16] = {
+   "b", "y", "select", "start", "up", "down", "left", "right",
+   "a", "x", "l", "r", "l2", "r2", "l3", "r3"
+};
+
+static UINT64 __cdecl bench_clock(void)
+{
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return (UINT64)ts.tv_sec * 1000000000ULL + (UINT64)ts.tv_nsec;
+}
+
+static void bench_log(enum retro_log_level level, const char *fmt, ...)
+{
+   va_list ap;
+
+   if (!verbose && level < RETRO_LOG_WARN)
+      return;
+
+   va_start(ap, fmt);
+   vfprintf(stderr, fmt, ap);
+   va_end(ap);
+}
+
+static bool bench_environment(unsigned cmd, void *data)
+{
+   switch (cmd)
+   {
+      case RETRO_ENVIRONMENT_GET_LOG_INTERFACE:
+         ((struct retro_log_callback*)data)->log = bench_log;
+         return true;
+      case RETRO_ENVIRONMENT_GET_SAVE_DIRECTORY:
+      case RETRO_ENVIRONMENT_GET_SYSTEM_DIRECTORY:
+         *(const char**)data = save_dir;
+         return true;
+      case RETRO_ENVIRONMENT_GET_VARIABLE:
+      {
+         struct retro_variable *var = (struct retro_variable*)data;
+         unsigned i;
+
+         for (i = 0; i < option_count; i++)
+         {
+            if (!strcmp(var->key, option_keys[i]))
+            {
+               var->value = option_values[i];
+               return true;
+            }
+         }
+         return false;
+      }
+      case RETRO_ENVIRONMENT_GET_CAN_DUPE:
+         *(bool*)data = true;
+         return true;
+      case RETRO_ENVIRONMENT_SET_PIXEL_FORMAT:
+         video_bpp = *(const enum retro_pixel_format*)data == RETRO_PIXEL_FORMAT_XRGB8888 ? 4 : 2;
+         return true;
+      case RETRO_ENVIRONMENT_SET_ROTATION:
+      case RETRO_ENVIRONMENT_SET_INPUT_DESCRIPTORS:
+      case RETRO_ENVIRONMENT_SET_VARIABLES:
+         return true;
+      default:
+         break;
+   }
+
+   return false;
+}
+
+static void bench_video(const void *data, unsigned width, unsigned height, size_t pitch)
+{
+   const uint8_t *line = (const uint8_t*)data;
+   unsigned y;
+
+   /* A NULL frame is a dupe of the previous one, keep its hash */
+   if (!hash_fp || !data)
+      return;
+
+   video_crc = crc32(0L, Z_NULL, 0);
+   for (y = 0; y < height; y++, line += pitch)
+      video_crc = crc32(video_crc, line, width * video_bpp);
+}
+
+static size_t bench_audio_batch(const int16_t *data, size_t frames)
+{
+   if (hash_fp)
+      audio_crc = crc32(crc32(0L, Z_NULL, 0), (const Bytef*)data, frames * 2 * sizeof(int16_t));
+
+   return frames;
+}
+
+static void bench_audio(int16_t left, int16_t right)
+{
+}
+
+static void bench_input_poll(void)
+{
+   while (event_next < event_count && events[event_next].frame <= frame_current)
+   {
+      port_state[events[event_next].port] = events[event_next].buttons;
+      event_next++;
+   }
+}
+
+static int16_t bench_input_state(unsigned port, unsigned device, unsigned index, unsigned id)
+{
+   if (port >= BENCH_MAX_PORTS || device != RETRO_DEVICE_JOYPAD)
+      return 0;
+
+   if (id == RETRO_DEVICE_ID_JOYPAD_MASK)
+      return port_state[port];
+
+   if (id < 16)
+      return (port_state[port] >> id) & 1;
+
+   return 0;
+}
+
+static int parse_buttons(const char *str, uint16_t *buttons)
+{
+   char tmp[256];
+   char *tok;
+
+   *buttons = 0;
+   if (!strcmp(str, "none"))
+      return 0;
+
+   strncpy(tmp, str, sizeof(tmp) - 1);
+   tmp[sizeof(tmp) - 1] = '\0';
+
+   for (tok = strtok(tmp, "+"); tok; tok = strtok(NULL, "+"))
+   {
+      unsigned i;
+
+      for (i = 0; i < 16; i++)
+         if (!strcmp(tok, button_names[i]))
+            break;
+
+      if (i == 16)
+         return 1;
+
+      *buttons |= 1 << i;
+   }
+
+   return 0;
+}
+
+static int load_input_script(const char *path)
+{
+   char line[512];
+   unsigned line_no = 0;
+   unsigned capacity = 0;
+   FILE *fp = fopen(path, "r");
+
+   if (!fp)
+   {
+      fprintf(stderr, "Cannot open input script %s\n", path);
+      return 1;
+   }
+
+   while (fgets(line, sizeof(line), fp))
+   {
+      struct bench_event ev;
+      char buttons[256];
+      char *comment = strchr(line, '#');
+
+      line_no++;
+      if (comment)
+         *comment = '\0';
+
+      if (sscanf(line, "%u %u %255s", &ev.frame, &ev.port, buttons) != 3)
+         continue;
+
+      if (ev.port >= BENCH_MAX_PORTS || parse_buttons(buttons, &ev.buttons))
+      {
+         fprintf(stderr, "%s:%u: bad input event\n", path, line_no);
+         fclose(fp);
+         return 1;
+      }
+
+      if (event_count && ev.frame < events[event_count - 1].frame)
+      {
+         fprintf(stderr, "%s:%u: events must be in frame order\n", path, line_no);
+         fclose(fp);
+         return 1;
+      }
+
+      if (event_count == capacity)
+      {
+         capacity = capacity ? capacity * 2 : 64;
+         events = (struct bench_event*)realloc(events, capacity * sizeof(struct bench_event));
+      }
+      events[event_count++] = ev;
+   }
+
+   fclose(fp);
+   return 0;
+}
+
+static int add_option(const char *str)
+{
+   const char *eq = strchr(str, '=');
+
+   if (!eq || option_count == BENCH_MAX_OPTIONS || (size_t)(eq - str) >= sizeof(option_keys[0]))
+      return 1;
+
+   memcpy(option_keys[option_count], str, eq - str);
+   option_keys[option_count][eq - str] = '\0';
+   strncpy(option_values[option_count], eq + 1, sizeof(option_values[0]) - 1);
+   option_count++;
+
+   return 0;
+}
+
+static void remove_save_dir(void)
+{
+   char path[512];
+   struct dirent *entry;
+   DIR *dir = opendir(save_dir);
+
+   if (dir)
+   {
+      while ((entry = readdir(dir)))
+      {
+         if (entry->d_name[0] == '.')
+            continue;
+
+         snprintf(path, sizeof(path), "%s/%s", save_dir, entry->d_name);
+         remove(path);
+      }
+      closedir(dir);
+   }
+
+   rmdir(save_dir);
+}
+
+static void list_drivers(void)
+{
+   UINT32 i;
+   UINT32 old_active = nBurnDrvActive;
+
+   for (i = 0; i < nBurnDrvCount; i++)
+   {
+      nBurnDrvActive = i;
+      printf("%s\n", BurnDrvGetTextA(DRV_NAME));
+   }
+
+   nBurnDrvActive = old_active;
+}
+
+/* Returns 0 while the frame matches the baseline, 1 on the first mismatch */
+static int check_hash(FILE *fp, unsigned frame)
+{
+   unsigned base_frame, base_video, base_audio;
+
+   if (fscanf(fp, "%u %x %x", &base_frame, &base_video, &base_audio) != 3)
+   {
+      printf("frame %u: missing from baseline\n", frame);
+      return 1;
+   }
+
+   if (base_frame != frame || base_video != video_crc || base_audio != audio_crc)
+   {
+      printf("frame %u: video %08x (expected %08x), audio %08x (expected %08x)\n",
+            frame, video_crc, base_video, audio_crc, base_audio);
+      return 1;
+   }
+
+   return 0;
+}
+
+static void run_frame(void)
+{
+   retro_run();
+
+   if (!hash_fp)
+      return;
+
+   if (hash_write)
+      fprintf(hash_fp, "%u %08x %08x\n", frame_current, video_crc, audio_crc);
+   else if (!mismatch && check_hash(hash_fp, frame_current))
+      mismatch = frame_current + 1;
+}
+
+static void print_profile(UINT64 total, unsigned frames)
+{
+   UINT64 accounted = 0;
+   INT32 i;
+
+   printf("\n%-12s %10s %8s %10s %10s\n", "section", "ms", "%", "us/frame", "calls");
+
+   for (i = 0; i < BURN_PROF_COUNT; i++)
+   {
+      UINT64 t = BurnProfGetTime(i);
+
+      // The render thread runs alongside the rest, so it's not part of the total
+      if (i != BURN_PROF_DRAW_THREAD)
+         accounted += t;
+
+      printf("%-12s %10.2f %7.2f%% %10.2f %10u\n", BurnProfGetName(i),
+            t / 1e6, total ? 100.0 * t / total : 0.0,
+            frames ? t / 1e3 / frames : 0.0, BurnProfGetCalls(i));
+   }
+
+   if (total > accounted)
+      printf("%-12s %10.2f %7.2f%% %10.2f\n", "other",
+            (total - accounted) / 1e6, 100.0 * (total - accounted) / total,
+            frames ? (total - accounted) / 1e3 / frames : 0.0);
+}
+
+static void usage(const char *argv0)
+{
+   fprintf(stderr,
+         "usage: %s [options] <romset.zip>\n"
+         "  -n <frames>     frames to time (default 3000)\n"
+         "  -w <frames>     untimed warm-up frames run first (default 0)\n"
+         "  -i <file>       replay an input script\n"
+         "  -o <key=value>  set a core option (repeatable)\n"
+         "  -p              report per-subsystem timings\n"
+         "  -H <file>       write per-frame video/audio hashes\n"
+         "  -c <file>       compare per-frame hashes against a baseline\n"
+         "  -l              list driver names and exit\n"
+         "  -v              show core log messages\n",
+         argv0);
+}
+
+int main(int argc, char **argv)
+{
+   struct retro_game_info info;
+   unsigned frames = 3000;
+   unsigned warmup = 0;
+   bool profile = false;
+   const char *hash_out = NULL;
+   const char *hash_check = NULL;
+   UINT64 start, total;
+   int opt;
+
+   while ((opt = getopt(argc, argv, "n:w:i:o:pH:c:lv")) != -1)
+   {
+      switch (opt)
+      {
+         case 'n':
+            frames = strtoul(optarg, NULL, 0);
+            break;
+         case 'w':
+            warmup = strtoul(optarg, NULL, 0);
+            break;
+         case 'i':
+            if (load_input_script(optarg))
+               return 1;
+            break;
+         case 'o':
+            if (add_option(optarg))
+            {
+               fprintf(stderr, "Bad core option %s\n", optarg);
+               return 1;
+            }
+            break;
+         case 'p':
+            profile = true;
+            break;
+         case 'H':
+            hash_out = optarg;
+            break;
+         case 'c':
+            hash_check = optarg;
+            break;
+         case 'l':
+            BurnLibInit();
+            list_drivers();
+            BurnLibExit();
+            return 0;
+         case 'v':
+            verbose = true;
+            break;
+         default:
+            usage(argv[0]);
+            return 1;
+      }
+   }
+
+   if (optind != argc - 1 || (hash_out && hash_check))
+   {
+      usage(argv[0]);
+      return 1;
+   }
+
+   if (hash_out || hash_check)
+   {
+      hash_fp = fopen(hash_out ? hash_out : hash_check, hash_out ? "w" : "r");
+      if (!hash_fp)
+      {
+         fprintf(stderr, "Cannot open %s\n", hash_out ? hash_out : hash_check);
+         return 1;
+      }
+      hash_write = hash_out != NULL;
+   }
+
+   /* Keep NVRAM from earlier runs out of the measurement */
+   strcpy(save_dir, "/tmp/cps2bench-XXXXXX");
+   if (!mkdtemp(save_dir))
+   {
+      perror("mkdtemp");
+      return 1;
+   }
+
+   retro_set_environment(bench_environment);
+   retro_set_video_refresh(bench_video);
+   retro_set_audio_sample(bench_audio);
+   retro_set_audio_sample_batch(bench_audio_batch);
+   retro_set_input_poll(bench_input_poll);
+   retro_set_input_state(bench_input_state);
+   retro_init();
+
+   memset(&info, 0, sizeof(info));
+   info.path = argv[optind];
+
+   if (!retro_load_game(&info))
+   {
+      fprintf(stderr, "Cannot load %s\n", info.path);
+      remove_save_dir();
+      retro_deinit();
+      if (hash_fp)
+         fclose(hash_fp);
+      return 1;
+   }
+
+   for (frame_current = 0; frame_current < warmup; frame_current++)
+      run_frame();
+
+   if (profile)
+      BurnExtProfileClockCallback = bench_clock;
+   BurnProfReset();
+
+   start = bench_clock();
+   for (; frame_current < warmup + frames; frame_current++)
+      run_frame();
+   total = bench_clock() - start;
+
+   BurnExtProfileClockCallback = NULL;
+
+   printf("%s: %u frames in %.3f s, %.2f fps\n", BurnDrvGetTextA(DRV_NAME),
+         frames, total / 1e9, total ? frames * 1e9 / total : 0.0);
+
+   if (profile)
+      print_profile(total, frames);
+
+   if (hash_fp)
+   {
+      if (hash_check)
+         printf("%s: %s\n", BurnDrvGetTextA(DRV_NAME), mismatch ? "FAILED" : "ok");
+      fclose(hash_fp);
+   }
+
+   retro_unload_game();
+   remove_save_dir();
+   retro_deinit();
+   free(events);
+
+   return mismatch ? 2 : 0;
+}
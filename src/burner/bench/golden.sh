@@ -0,0 +1,65 @@
+#!/bin/sh
+# Golden-frame regression runner
+#
+#   golden.sh record <romdir> <baselinedir> [driver ...]
+#   golden.sh check  <romdir> <baselinedir> [driver ...]
+#
+# Every driver whose zip is present in <romdir> (all drivers by default) is
+# run through the same input script; "record" stores the per-frame video and
+# audio hashes in <baselinedir>/<driver>.crc, "check" compares against them.
+#
+# BENCH, FRAMES and INPUT can be overridden from the environment.
+
+BENCH=${BENCH:-./cps2bench}
+FRAMES=${FRAMES:-1800}
+INPUT=${INPUT:-$(dirname "$0")/golden.inp}
+
+if [ $# -lt 3 ] || { [ "$1" != record ] && [ "$1" != check ]; }; then
+	echo "usage: $0 record|check <romdir> <baselinedir> [driver ...]" >&2
+	exit 1
+fi
+
+mode=$1
+romdir=$2
+basedir=$3
+shift 3
+
+if [ $# -eq 0 ]; then
+	set -- $("$BENCH" -l)
+fi
+
+mkdir -p "$basedir" || exit 1
+
+pass=0
+fail=0
+skip=0
+
+for drv in "$@"; do
+	if [ ! -f "$romdir/$drv.zip" ]; then
+		skip=$((skip + 1))
+		continue
+	fi
+
+	if [ "$mode" = record ]; then
+		"$BENCH" -n "$FRAMES" -i "$INPUT" -H "$basedir/$drv.crc" "$romdir/$drv.zip" >/dev/null
+		status=$?
+	elif [ ! -f "$basedir/$drv.crc" ]; then
+		echo "$drv: no baseline"
+		skip=$((skip + 1))
+		continue
+	else
+		out=$("$BENCH" -n "$FRAMES" -i "$INPUT" -c "$basedir/$drv.crc" "$romdir/$drv.zip")
+		status=$?
+		echo "$out" | grep "^frame"
+	fi
+
+	if [ $status -eq 0 ]; then
+		pass=$((pass + 1))
+	else
+		echo "$drv: FAILED"
+		fail=$((fail + 1))
+	fi
+done
+
+echo "$pass passed, $fail failed, $skip skipped"
+[ $fail -eq 0 ]
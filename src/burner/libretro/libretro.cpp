@@ -5,9 +5,14 @@
 #include <vector>
 #include <string>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include "libretro.h"
 #include "libretro_core_options.h"
 #include "burner.h"
+#include "m68000_intf.h"
 #include "input/inp_keys.h"
 #include "state.h"
 #include "descriptors.h"
@@ -53,8 +58,11 @@ static unsigned g_rom_count;
 #define VIDEO_REFRESH_RATE 60
 #endif
 
-static uint16_t *g_fba_frame      = NULL;
-static uint16_t *g_fba_rotate_buf = NULL;
+static uint8_t *g_fba_frame       = NULL;
+static uint8_t *g_fba_frame_prev  = NULL;
+static uint8_t *g_fba_rotate_buf  = NULL;
+static bool g_fba_frame_shown     = false; // The last frame drawn has been sent to the frontend
+static bool g_fba_frame_dupe      = false; // The frontend can repeat the last frame for us
 static int16_t g_audio_buf[AUDIO_SEGMENT_LENGTH * 2];
 
 static uint16_t rotate_buf_width  = 0;
@@ -89,6 +97,7 @@ char g_system_dir[1024];
 static bool driver_inited       = false;
 static bool core_aspect_par     = false;
 static bool display_auto_rotate = true;
+static bool color_depth_32 = false;
 static bool display_rotated     = false;
 static bool hw_rotate_enabled   = false;
 static bool input_rotated       = false;
@@ -485,12 +494,17 @@ void retro_init(void)
 void retro_deinit(void)
 {
    GameInpExit();
+   BurnThreadExit();
    BurnLibExit();
 
    if (g_fba_frame)
       free(g_fba_frame);
    g_fba_frame = NULL;
 
+   if (g_fba_frame_prev)
+      free(g_fba_frame_prev);
+   g_fba_frame_prev = NULL;
+
    if (g_fba_rotate_buf)
       free(g_fba_rotate_buf);
    g_fba_rotate_buf = NULL;
@@ -499,11 +513,22 @@ void retro_deinit(void)
 extern "C" {
    INT32 Cps2Frame(void);
    void HiscoreApply(void);
+   extern INT32 bCpstGfx8;
+   extern INT32 bCpsDrawThread;
+   extern INT32 bCpsDrawLines;
+   extern INT32 bCpsSkipSame;
+   extern INT32 bCpsFrameSame;
+   extern INT32 Cps2IdleSkip;
+   extern INT32 Cps2ZIdleSkip;
+   extern INT32 bQscNativeRate;
+   extern INT32 bQscFrameSilent;
+   extern INT32 Cps2Z80SyncLines;
 };
 
 void retro_reset(void)
 {
    struct GameInp* pgi = GameInp;
+   INT32 width, height;
 
    for (unsigned i = 0; i < nGameInpCount; i++, pgi++)
    {
@@ -516,6 +541,10 @@ void retro_reset(void)
       break;
    }
 
+   BurnDrvGetFullSize(&width, &height);
+   pBurnDraw = g_fba_frame;
+   nBurnPitch = width * nBurnBpp;
+
    nBurnLayer = 0xff;
    pBurnSoundOut = g_audio_buf;
    nBurnSoundRate = AUDIO_SAMPLERATE;
@@ -523,6 +552,20 @@ void retro_reset(void)
    HiscoreApply();
    Cps2Frame();
 
+   /* The reset frame is drawn but not shown. Keep it
+    * in g_fba_frame_prev for the render thread, as
+    * retro_run() does */
+   if (!nSkipFrame && !bCpsFrameSame)
+   {
+      if (bCpsDrawThread)
+      {
+         uint8_t *tmp     = g_fba_frame;
+         g_fba_frame      = g_fba_frame_prev;
+         g_fba_frame_prev = tmp;
+      }
+      g_fba_frame_shown = false;
+   }
+
    low_pass_left_prev  = 0;
    low_pass_right_prev = 0;
 }
@@ -533,6 +576,7 @@ static void check_variables(bool first_run)
 {
    struct retro_variable var = {0};
    bool last_core_aspect_par;
+   INT32 last_draw_thread = bCpsDrawThread;
    unsigned last_frameskip_type;
 
    var.key             = "fba2012cps2_cpu_speed_adjust";
@@ -606,8 +650,128 @@ static void check_variables(bool first_run)
       if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var))
          if (strcmp(var.value, "disabled") == 0)
             display_auto_rotate = false;
+
+      var.key             = "fba2012cps2_color_depth";
+      var.value           = NULL;
+      color_depth_32      = false;
+
+      if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+         if (strcmp(var.value, "32bit") == 0)
+            color_depth_32 = true;
+
+      var.key             = "fba2012cps2_gfx_cache";
+      var.value           = NULL;
+      bCpstGfx8           = 0;
+
+      if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+         if (strcmp(var.value, "enabled") == 0)
+            bCpstGfx8 = 1;
+
+      var.key             = "fba2012cps2_idle_skip";
+      var.value           = NULL;
+      Cps2IdleSkip        = 1;
+
+      if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+         if (strcmp(var.value, "disabled") == 0)
+            Cps2IdleSkip = 0;
+
+      var.key             = "fba2012cps2_z80_idle_skip";
+      var.value           = NULL;
+      Cps2ZIdleSkip       = 0;
+
+      if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+         if (strcmp(var.value, "enabled") == 0)
+            Cps2ZIdleSkip = 1;
+
+      var.key             = "fba2012cps2_qsound_native";
+      var.value           = NULL;
+      bQscNativeRate      = 0;
+
+      if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+         if (strcmp(var.value, "enabled") == 0)
+            bQscNativeRate = 1;
+
+#if defined(EMU_C68K) || defined(EMU_M68K_DRC)
+      var.key             = "fba2012cps2_cpu_core";
+      var.value           = NULL;
+      nSekCpuCore         = SEK_CORE_M68K;
+
+      if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+      {
+#if defined(EMU_C68K)
+         if (strcmp(var.value, "c68k") == 0)
+            nSekCpuCore = SEK_CORE_C68K;
+#endif
+#if defined(EMU_M68K_DRC)
+         if (strcmp(var.value, "drc") == 0)
+            nSekCpuCore = SEK_CORE_DRC;
+#endif
+      }
+#endif
+   }
+
+   var.key             = "fba2012cps2_z80_sync";
+   var.value           = NULL;
+   Cps2Z80SyncLines    = 0;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+      if (strcmp(var.value, "disabled") != 0)
+         Cps2Z80SyncLines = strtol(var.value, NULL, 10);
+
+#if defined(HAVE_THREADS)
+   var.key             = "fba2012cps2_render_threads";
+   var.value           = NULL;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+      INT32 threads = strtol(var.value, NULL, 10);
+
+      if (threads != BurnThreadCount())
+         BurnThreadInit(threads);
    }
 
+   var.key             = "fba2012cps2_render_pipeline";
+   var.value           = NULL;
+   bCpsDrawThread      = 0;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+      if (strcmp(var.value, "enabled") == 0)
+         bCpsDrawThread = 1;
+#endif
+
+   var.key             = "fba2012cps2_line_render";
+   var.value           = NULL;
+   bCpsDrawLines       = 0;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+      if (strcmp(var.value, "enabled") == 0)
+         bCpsDrawLines = 1;
+
+   /* Lines are drawn during the frame, there is
+    * nothing to hand to the render thread */
+   if (bCpsDrawLines)
+      bCpsDrawThread = 0;
+
+   /* The last frame drawn is in g_fba_frame_prev while
+    * the render thread is on, and in g_fba_frame if not */
+   if (bCpsDrawThread != last_draw_thread)
+   {
+      uint8_t *tmp     = g_fba_frame;
+      g_fba_frame      = g_fba_frame_prev;
+      g_fba_frame_prev = tmp;
+   }
+
+   var.key             = "fba2012cps2_skip_unchanged";
+   var.value           = NULL;
+   bCpsSkipSame        = 1;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+      if (strcmp(var.value, "disabled") == 0)
+         bCpsSkipSame = 0;
+
+   if (!environ_cb(RETRO_ENVIRONMENT_GET_CAN_DUPE, &g_fba_frame_dupe))
+      g_fba_frame_dupe = false;
+
    var.key             = "fba2012cps2_lowpass_filter";
    var.value           = NULL;
    low_pass_enabled    = false;
@@ -648,12 +812,149 @@ static void check_variables(bool first_run)
       init_frameskip();
 }
 
+/* Software display rotation: pixel (x, y) of the frame goes to
+ * line (width - 1 - x), column (y + rotate_buf_margin) of
+ * g_fba_rotate_buf. Writing whole columns one pixel at a time
+ * touches a different cache line for every pixel, so the frame
+ * is transposed in 8x8 blocks instead */
+#define ROTATE_BLOCK 8
+
+#if defined(__SSE2__)
+/* Transpose 8x8 16 bit pixels: column c of src goes to dst - c * dst_pitch */
+static INLINE void rotate_block_16_sse2(const uint16_t *src, unsigned src_pitch, uint16_t *dst, unsigned dst_pitch)
+{
+   __m128i r0 = _mm_loadu_si128((const __m128i*)(src + 0 * src_pitch));
+   __m128i r1 = _mm_loadu_si128((const __m128i*)(src + 1 * src_pitch));
+   __m128i r2 = _mm_loadu_si128((const __m128i*)(src + 2 * src_pitch));
+   __m128i r3 = _mm_loadu_si128((const __m128i*)(src + 3 * src_pitch));
+   __m128i r4 = _mm_loadu_si128((const __m128i*)(src + 4 * src_pitch));
+   __m128i r5 = _mm_loadu_si128((const __m128i*)(src + 5 * src_pitch));
+   __m128i r6 = _mm_loadu_si128((const __m128i*)(src + 6 * src_pitch));
+   __m128i r7 = _mm_loadu_si128((const __m128i*)(src + 7 * src_pitch));
+   __m128i t0 = _mm_unpacklo_epi16(r0, r1);
+   __m128i t1 = _mm_unpackhi_epi16(r0, r1);
+   __m128i t2 = _mm_unpacklo_epi16(r2, r3);
+   __m128i t3 = _mm_unpackhi_epi16(r2, r3);
+   __m128i t4 = _mm_unpacklo_epi16(r4, r5);
+   __m128i t5 = _mm_unpackhi_epi16(r4, r5);
+   __m128i t6 = _mm_unpacklo_epi16(r6, r7);
+   __m128i t7 = _mm_unpackhi_epi16(r6, r7);
+   __m128i u0 = _mm_unpacklo_epi32(t0, t2);
+   __m128i u1 = _mm_unpackhi_epi32(t0, t2);
+   __m128i u2 = _mm_unpacklo_epi32(t1, t3);
+   __m128i u3 = _mm_unpackhi_epi32(t1, t3);
+   __m128i u4 = _mm_unpacklo_epi32(t4, t6);
+   __m128i u5 = _mm_unpackhi_epi32(t4, t6);
+   __m128i u6 = _mm_unpacklo_epi32(t5, t7);
+   __m128i u7 = _mm_unpackhi_epi32(t5, t7);
+
+   _mm_storeu_si128((__m128i*)(dst - 0 * dst_pitch), _mm_unpacklo_epi64(u0, u4));
+   _mm_storeu_si128((__m128i*)(dst - 1 * dst_pitch), _mm_unpackhi_epi64(u0, u4));
+   _mm_storeu_si128((__m128i*)(dst - 2 * dst_pitch), _mm_unpacklo_epi64(u1, u5));
+   _mm_storeu_si128((__m128i*)(dst - 3 * dst_pitch), _mm_unpackhi_epi64(u1, u5));
+   _mm_storeu_si128((__m128i*)(dst - 4 * dst_pitch), _mm_unpacklo_epi64(u2, u6));
+   _mm_storeu_si128((__m128i*)(dst - 5 * dst_pitch), _mm_unpackhi_epi64(u2, u6));
+   _mm_storeu_si128((__m128i*)(dst - 6 * dst_pitch), _mm_unpacklo_epi64(u3, u7));
+   _mm_storeu_si128((__m128i*)(dst - 7 * dst_pitch), _mm_unpackhi_epi64(u3, u7));
+}
+
+/* Transpose 4x4 32 bit pixels: column c of src goes to dst - c * dst_pitch */
+static INLINE void rotate_block_32_sse2(const uint32_t *src, unsigned src_pitch, uint32_t *dst, unsigned dst_pitch)
+{
+   __m128i r0 = _mm_loadu_si128((const __m128i*)(src + 0 * src_pitch));
+   __m128i r1 = _mm_loadu_si128((const __m128i*)(src + 1 * src_pitch));
+   __m128i r2 = _mm_loadu_si128((const __m128i*)(src + 2 * src_pitch));
+   __m128i r3 = _mm_loadu_si128((const __m128i*)(src + 3 * src_pitch));
+   __m128i t0 = _mm_unpacklo_epi32(r0, r1);
+   __m128i t1 = _mm_unpackhi_epi32(r0, r1);
+   __m128i t2 = _mm_unpacklo_epi32(r2, r3);
+   __m128i t3 = _mm_unpackhi_epi32(r2, r3);
+
+   _mm_storeu_si128((__m128i*)(dst - 0 * dst_pitch), _mm_unpacklo_epi64(t0, t2));
+   _mm_storeu_si128((__m128i*)(dst - 1 * dst_pitch), _mm_unpackhi_epi64(t0, t2));
+   _mm_storeu_si128((__m128i*)(dst - 2 * dst_pitch), _mm_unpacklo_epi64(t1, t3));
+   _mm_storeu_si128((__m128i*)(dst - 3 * dst_pitch), _mm_unpackhi_epi64(t1, t3));
+}
+#endif
+
+static void rotate_frame_16(const uint16_t *in, uint16_t *out, unsigned width, unsigned height)
+{
+   /* Local copies, the stores through out could otherwise alias them */
+   unsigned pitch  = rotate_buf_width;
+   unsigned margin = rotate_buf_margin;
+   unsigned bx, by, x, y, x_count, y_end;
+
+   for (by = 0; by < height; by += ROTATE_BLOCK)
+   {
+      for (bx = 0; bx < width; bx += ROTATE_BLOCK)
+      {
+#if defined(__SSE2__)
+         if (bx + ROTATE_BLOCK <= width && by + ROTATE_BLOCK <= height)
+         {
+            rotate_block_16_sse2(in + bx + (by * width), width,
+                  out + (by + margin) + (((width - 1) - bx) * pitch), pitch);
+            continue;
+         }
+#endif
+         x_count = (bx + ROTATE_BLOCK < width) ? ROTATE_BLOCK : width - bx;
+         y_end = (by + ROTATE_BLOCK < height) ? by + ROTATE_BLOCK : height;
+
+         for (y = by; y < y_end; y++)
+         {
+            const uint16_t *in_ptr = in + bx + (y * width);
+            uint16_t *out_ptr = out + (y + margin) + (((width - 1) - bx) * pitch);
+
+            for (x = 0; x < x_count; x++, out_ptr -= pitch)
+               *out_ptr = in_ptr[x];
+         }
+      }
+   }
+}
+
+static void rotate_frame_32(const uint32_t *in, uint32_t *out, unsigned width, unsigned height)
+{
+   /* Local copies, the stores through out could otherwise alias them */
+   unsigned pitch  = rotate_buf_width;
+   unsigned margin = rotate_buf_margin;
+   unsigned bx, by, x, y, x_count, y_end;
+
+   for (by = 0; by < height; by += ROTATE_BLOCK)
+   {
+      for (bx = 0; bx < width; bx += ROTATE_BLOCK)
+      {
+#if defined(__SSE2__)
+         if (bx + ROTATE_BLOCK <= width && by + ROTATE_BLOCK <= height)
+         {
+            for (y = by; y < by + ROTATE_BLOCK; y += 4)
+               for (x = bx; x < bx + ROTATE_BLOCK; x += 4)
+                  rotate_block_32_sse2(in + x + (y * width), width,
+                        out + (y + margin) + (((width - 1) - x) * pitch), pitch);
+            continue;
+         }
+#endif
+         x_count = (bx + ROTATE_BLOCK < width) ? ROTATE_BLOCK : width - bx;
+         y_end = (by + ROTATE_BLOCK < height) ? by + ROTATE_BLOCK : height;
+
+         for (y = by; y < y_end; y++)
+         {
+            const uint32_t *in_ptr = in + bx + (y * width);
+            uint32_t *out_ptr = out + (y + margin) + (((width - 1) - bx) * pitch);
+
+            for (x = 0; x < x_count; x++, out_ptr -= pitch)
+               *out_ptr = in_ptr[x];
+         }
+      }
+   }
+}
+
 void retro_run(void)
 {
    INT32 width, height;
+   uint8_t *frame;
+   bool dupe;
    BurnDrvGetFullSize(&width, &height);
-   pBurnDraw = (uint8_t*)g_fba_frame;
-   nBurnPitch = width * sizeof(uint16_t);
+   pBurnDraw = g_fba_frame;
+   nBurnPitch = width * nBurnBpp;
    nSkipFrame = 0;
 
    poll_input();
@@ -702,34 +1003,61 @@ void retro_run(void)
    HiscoreApply();
    Cps2Frame();
 
+   frame = g_fba_frame;
+   dupe  = nSkipFrame;
+
+   if (!nSkipFrame)
+   {
+      if (bCpsFrameSame)
+      {
+         /* Nothing has changed since the last frame drawn,
+          * have the frontend repeat it if it is on screen */
+         if (bCpsDrawThread)
+            frame = g_fba_frame_prev;
+         if (g_fba_frame_shown && g_fba_frame_dupe)
+            dupe = true;
+         g_fba_frame_shown = true;
+      }
+      else if (bCpsDrawThread)
+      {
+         /* With the render thread, this frame is still being
+          * drawn into g_fba_frame: show the previous one */
+         uint8_t *tmp     = g_fba_frame;
+         g_fba_frame      = g_fba_frame_prev;
+         g_fba_frame_prev = tmp;
+         frame            = g_fba_frame;
+         g_fba_frame_shown = false;
+      }
+      else
+         g_fba_frame_shown = true;
+   }
+
    if (!display_rotated || hw_rotate_enabled)
    {
-      if (!nSkipFrame)
-         video_cb(g_fba_frame, width, height, nBurnPitch);
+      if (!dupe)
+         video_cb(frame, width, height, nBurnPitch);
       else
          video_cb(NULL, width, height, nBurnPitch);
    }
    else
    {
       /* Perform software-based display rotation */
-      if (!nSkipFrame)
+      if (!dupe)
       {
-         uint16_t *in_ptr  = g_fba_frame;
-         uint16_t *out_ptr = g_fba_rotate_buf;
-         size_t x, y;
-
-         for (y = 0; y < height; y++)
-            for (x = 0; x < width; x++)
-               *(out_ptr + (y + rotate_buf_margin) + (((width - 1) - x) * rotate_buf_width)) =
-                     *(in_ptr + x + (y * width));
+         if (nBurnBpp == 4)
+            rotate_frame_32((uint32_t*)frame, (uint32_t*)g_fba_rotate_buf, width, height);
+         else
+            rotate_frame_16((uint16_t*)frame, (uint16_t*)g_fba_rotate_buf, width, height);
 
-         video_cb(g_fba_rotate_buf, rotate_buf_width, width, rotate_buf_width * sizeof(uint16_t));
+         video_cb(g_fba_rotate_buf, rotate_buf_width, width, rotate_buf_width * nBurnBpp);
       }
       else
-         video_cb(NULL, rotate_buf_width, width, rotate_buf_width * sizeof(uint16_t));
+         video_cb(NULL, rotate_buf_width, width, rotate_buf_width * nBurnBpp);
    }
 
-   if (low_pass_enabled)
+   /* Silence through a settled filter is still silence */
+   if (low_pass_enabled &&
+         !(bQscFrameSilent && low_pass_left_prev == 0 && low_pass_right_prev == 0))
       low_pass_filter_stereo(g_audio_buf, nBurnSoundLen);
 
    audio_batch_cb(g_audio_buf, nBurnSoundLen);
@@ -860,7 +1188,20 @@ static bool fba_init(unsigned driver, const char *game_zip_name)
    if (!open_archive())
       return false;
 
+   /* The palette is built for nBurnBpp in BurnDrvInit,
+    * so the pixel format has to be settled first */
    nBurnBpp = 2;
+   if (color_depth_32)
+   {
+      enum retro_pixel_format fmt32 = RETRO_PIXEL_FORMAT_XRGB8888;
+
+      if (environ_cb(RETRO_ENVIRONMENT_SET_PIXEL_FORMAT, &fmt32))
+      {
+         nBurnBpp = 4;
+         if (log_cb)
+            log_cb(RETRO_LOG_INFO, "Frontend supports XRGB8888 - will use 32 bit output.\n");
+      }
+   }
    nFMInterpolation = 3;
    nInterpolation = 3;
 
@@ -873,7 +1214,7 @@ static bool fba_init(unsigned driver, const char *game_zip_name)
 
    INT32 width, height;
    BurnDrvGetFullSize(&width, &height);
-   nBurnPitch = width * sizeof(uint16_t);
+   nBurnPitch = width * nBurnBpp;
 
    unsigned drv_flags = BurnDrvGetFlags();
 
@@ -915,8 +1256,8 @@ static bool fba_init(unsigned driver, const char *game_zip_name)
          rotate_buf_width  = height;
          rotate_buf_margin = 0;
 #endif
-         g_fba_rotate_buf = (uint16_t*)calloc(1,
-               (uint32_t)rotate_buf_width * (uint32_t)rotate_buf_height * sizeof(uint16_t));
+         g_fba_rotate_buf = (uint8_t*)calloc(1,
+               (uint32_t)rotate_buf_width * (uint32_t)rotate_buf_height * nBurnBpp);
       }
    }
 
@@ -925,7 +1266,7 @@ static bool fba_init(unsigned driver, const char *game_zip_name)
 #ifdef FRONTEND_SUPPORTS_RGB565
    enum retro_pixel_format fmt = RETRO_PIXEL_FORMAT_RGB565;
 
-   if(environ_cb(RETRO_ENVIRONMENT_SET_PIXEL_FORMAT, &fmt))
+   if (nBurnBpp == 2 && environ_cb(RETRO_ENVIRONMENT_SET_PIXEL_FORMAT, &fmt))
       if (log_cb)
          log_cb(RETRO_LOG_INFO, "Frontend supports RGB565 - will use that instead of XRGB1555.\n");
 #endif
@@ -1023,7 +1364,8 @@ bool retro_load_game(const struct retro_game_info *info)
       analog_controls_enabled = init_input();
 
       BurnDrvGetFullSize(&width, &height);
-      g_fba_frame = (uint16_t*)malloc((uint32_t)width * (uint32_t)height * sizeof(uint16_t));
+      g_fba_frame = (uint8_t*)malloc((uint32_t)width * (uint32_t)height * nBurnBpp);
+      g_fba_frame_prev = (uint8_t*)calloc(1, (uint32_t)width * (uint32_t)height * nBurnBpp);
 
       retval = true;
    }
@@ -134,6 +134,100 @@ struct retro_core_option_v2_definition option_defs_us[] = {
       },
       "enabled"
    },
+   {
+      "fba2012cps2_color_depth",
+      "Color Depth (Restart Required)",
+      NULL,
+      "Output 32 bit XRGB8888 frames instead of 16 bit RGB565. Keeps the full 8 bits per channel of the palette, at the cost of twice the video memory bandwidth.",
+      NULL,
+      NULL,
+      {
+         { "16bit", "16-bit (RGB565)" },
+         { "32bit", "32-bit (XRGB8888)" },
+         { NULL, NULL },
+      },
+      "16bit"
+   },
+   {
+      "fba2012cps2_idle_skip",
+      "Idle Loop Skipping (Restart Required)",
+      NULL,
+      "When the main CPU goes round a short loop that only polls memory, skips the passes left before the end of its current timeslice. The result is the same as running the loop, but takes less time.",
+      NULL,
+      NULL,
+      {
+         { "enabled",  NULL },
+         { "disabled", NULL },
+         { NULL, NULL },
+      },
+      "enabled"
+   },
+   {
+      "fba2012cps2_z80_idle_skip",
+      "QSound Z80 Idle Loop Skipping (Restart Required)",
+      NULL,
+      "When the QSound Z80 goes round a loop waiting for its next interrupt, skips the passes left before the end of its current timeslice. Meant to give the same sound as running the loop, but not yet checked against every game.",
+      NULL,
+      NULL,
+      {
+         { "disabled", NULL },
+         { "enabled",  NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
+#if defined(EMU_C68K) || defined(EMU_M68K_DRC)
+   {
+      "fba2012cps2_cpu_core",
+      "68000 Core (Restart Required)",
+      NULL,
+      "Selects the 68000 emulator. 'Musashi Recompiler' translates the game's code to host code and runs it on Musashi's state, so it shares Musashi's save states and idle loop skipping. 'C68K' is faster on some hosts, but 68000 idle loop skipping and the decoded opcode cache only work with Musashi. Save states made with C68K only load with C68K.",
+      NULL,
+      NULL,
+      {
+         { "musashi", "Musashi" },
+#if defined(EMU_M68K_DRC)
+         { "drc",     "Musashi Recompiler" },
+#endif
+#if defined(EMU_C68K)
+         { "c68k",    "C68K" },
+#endif
+         { NULL, NULL },
+      },
+      "musashi"
+   },
+#endif
+   {
+      "fba2012cps2_qsound_native",
+      "QSound Native Rate Mixing (Restart Required)",
+      NULL,
+      "Mixes the QSound channels at the chip's own rate of about 24kHz, then converts the mix to the output rate with one high quality filter. Less work per channel and cleaner high frequencies at 44.1/48kHz than interpolating each channel to the output rate.",
+      NULL,
+      NULL,
+      {
+         { "disabled", NULL },
+         { "enabled",  NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
+   {
+      "fba2012cps2_z80_sync",
+      "QSound Z80 Sync Interval",
+      NULL,
+      "Brings the QSound Z80 up to date with the 68000 every so many scanlines. When disabled, the Z80 only catches up when the 68000 uses the sound RAM, and at the end of the frame. Shorter intervals keep the two CPUs closer together but take more time.",
+      NULL,
+      NULL,
+      {
+         { "disabled", NULL },
+         { "64",       "64 Lines" },
+         { "16",       "16 Lines" },
+         { "4",        "4 Lines" },
+         { "1",        "1 Line" },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
    {
       "fba2012cps2_lowpass_filter",
       "Audio Filter",
@@ -222,6 +316,80 @@ struct retro_core_option_v2_definition option_defs_us[] = {
       },
       "33"
    },
+   {
+      "fba2012cps2_gfx_cache",
+      "8bpp Tile Cache (Restart Required)",
+      NULL,
+      "Keeps an unpacked one byte per pixel copy of the game graphics, so tiles are drawn without unpacking pixels and empty tiles are skipped. Faster, but doubles the memory used by the graphics ROMs.",
+      NULL,
+      NULL,
+      {
+         { "disabled", NULL },
+         { "enabled",  NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
+   {
+      "fba2012cps2_skip_unchanged",
+      "Skip Unchanged Frames",
+      NULL,
+      "Doesn't redraw a frame when nothing on screen has changed since the last one (menus, pauses, static screens) and lets the frontend repeat the last frame instead. Frames with masked sprites are always redrawn, as they depend on earlier frames. The picture is the same, with less CPU time used.",
+      NULL,
+      NULL,
+      {
+         { "disabled", NULL },
+         { "enabled",  NULL },
+         { NULL, NULL },
+      },
+      "enabled"
+   },
+   {
+      "fba2012cps2_line_render",
+      "Line Based Raster Effects",
+      NULL,
+      "Runs the CPU a scanline at a time and draws each group of lines as soon as the video registers change. Removes the limit of 10 raster effects per frame and spreads drawing over the frame. Disables Threaded Rendering.",
+      NULL,
+      NULL,
+      {
+         { "disabled", NULL },
+         { "enabled",  NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
+#if defined(HAVE_THREADS)
+   {
+      "fba2012cps2_render_threads",
+      "Render Threads",
+      NULL,
+      "Splits the screen into horizontal bands which are drawn at the same time on several CPU cores. Helps on multi-core devices where drawing the layers competes with the CPU emulation for one core.",
+      NULL,
+      NULL,
+      {
+         { "1", NULL },
+         { "2", NULL },
+         { "3", NULL },
+         { "4", NULL },
+         { NULL, NULL },
+      },
+      "1"
+   },
+   {
+      "fba2012cps2_render_pipeline",
+      "Threaded Rendering (+1 Frame Latency)",
+      NULL,
+      "Draws each frame on a separate thread while the next frame is emulated. Lets drawing and CPU emulation run on different cores, at the cost of showing every frame one frame later.",
+      NULL,
+      NULL,
+      {
+         { "disabled", NULL },
+         { "enabled",  NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
+#endif
    { NULL, NULL, NULL, NULL, NULL, NULL, {{0}}, NULL },
 };
 
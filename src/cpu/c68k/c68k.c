@@ -11,6 +11,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stddef.h>
 #include "c68k.h"
 
 #ifndef IRQ_LINE_STATE
@@ -96,12 +97,13 @@ INT32 C68k_Exec(c68k_struc *CPU, INT32 cycles)
 {
 	if (CPU)
 	{
-		UINT32 PC;
+		uintptr_t PC;
 		UINT32 Opcode;
 		UINT32 adr;
 		UINT32 res;
 		UINT32 src;
 		UINT32 dst;
+		UINT32 *reg;
 
 		PC = CPU->PC;
 		CPU->ICount = cycles;
@@ -120,6 +122,8 @@ C68k_Exec_Next:
 					CPU->Dbg_CallBack();
 				}
 			#endif
+				if (PC >= CPU->LimitPC)
+					PC = CPU->Rebase_PC((UINT32)(PC - CPU->BasePC));
 				Opcode = READ_IMM_16();
 				PC += 2;
 				goto *JumpTable[Opcode];
@@ -168,7 +172,7 @@ UINT32 C68k_Get_Reg(c68k_struc *CPU, INT32 regnum)
 {
 	switch (regnum)
 	{
-	case C68K_PC:  return (CPU->PC - CPU->BasePC);
+	case C68K_PC:  return (UINT32)(CPU->PC - CPU->BasePC);
 	case C68K_USP: return (CPU->flag_S ? CPU->USP : CPU->A[7]);
 	case C68K_MSP: return (CPU->flag_S ? CPU->A[7] : CPU->USP);
 	case C68K_SR:  return GET_SR();
@@ -342,7 +346,7 @@ void C68k_Reset(c68k_struc *CPU)
 {
 	UINT32 PC;
 
-	memset(CPU, 0, (UINT32)&CPU->BasePC - (UINT32)CPU);
+	memset(CPU, 0, offsetof(c68k_struc, BasePC));
 
 	CPU->flag_I = 7;
 	CPU->flag_S = C68K_SR_S;
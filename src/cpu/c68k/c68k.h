@@ -11,6 +11,8 @@
 #ifndef C68K_H
 #define C68K_H
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -116,16 +118,17 @@ typedef struct c68k_t
 	unsigned int flag_S;
 
 	unsigned int USP;
-	unsigned int PC;
+	uintptr_t PC;			// Host pointer to the next opcode
 
 	unsigned int HaltState;
 	int IRQLine;
 	int IRQState;
 	int ICount;
 
-	unsigned int BasePC;
+	uintptr_t BasePC;		// PC - BasePC is the 68000 address
+	uintptr_t LimitPC;		// Opcodes at or past this are found through Rebase_PC again
 	
-	unsigned int (*Rebase_PC)(unsigned int newpc);
+	uintptr_t (*Rebase_PC)(unsigned int newpc);
 	//unsigned int Fetch[C68K_FETCH_BANK];
 
 	unsigned char  (*Read_Byte)(unsigned int address);
@@ -1716,7 +1716,7 @@
 	ostruct = c68k_opcode_jump_table;
 	if(JumpTable==NULL)
 	{
-		JumpTable=(void**)malloc(0x10000*sizeof(int));
+		JumpTable=(void**)malloc(0x10000*sizeof(void *));
 		if(JumpTable==NULL) return 0;
 	}
 	while (ostruct->match != 0x4afc)
@@ -135,7 +135,7 @@
 	RELEASE_CYCLES();														\
 	goto C68k_Check_Interrupt;
 
-#define GET_PC()				(PC - CPU->BasePC)
+#define GET_PC()				(UINT32)(PC - CPU->BasePC)
 
 
 #if 0
@@ -225,6 +225,11 @@
 #define CFLAG_ADD_32(S, D, R)	(((S & D & 1) + (S >> 1) + (D >> 1)) >> 23)
 #define CFLAG_SUB_32(S, D, R)	(((S & R & 1) + (S >> 1) + (R >> 1)) >> 23)
 
+// With X added in, the carry can't be found from S and D (or S and R) alone
+#define CFLAG_ADDX_32(S, D, R)	(((S & D) | (~R & (S | D))) >> 23)
+#define CFLAG_SUBX_32(S, D, R)	(((S & R) | (~D & (S | R))) >> 23)
+#define CFLAG_NEGX_32(S, R)		((S | R) >> 23)
+
 #define VFLAG_ADD_8(S, D, R)	((S ^ R) & (D ^ R))
 #define VFLAG_ADD_16(S, D, R)	(((S ^ R) & (D ^ R)) >> 8)
 #define VFLAG_ADD_32(S, D, R)	(((S ^ R) & (D ^ R)) >> 24)
@@ -491,7 +496,7 @@
 
 #define FLAGS_ADDX_32()														\
 	FLAG_Z |= ZFLAG_32(res);												\
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);							\
+	FLAG_X = FLAG_C = CFLAG_ADDX_32(src, dst, res);							\
 	FLAG_V = VFLAG_ADD_32(src, dst, res);									\
 	FLAG_N = NFLAG_32(res);
 
@@ -523,7 +528,7 @@
 
 #define FLAGS_SUBX_32()														\
 	FLAG_Z |= ZFLAG_32(res);												\
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);							\
+	FLAG_X = FLAG_C = CFLAG_SUBX_32(src, dst, res);							\
 	FLAG_V = VFLAG_SUB_32(src, dst, res);									\
 	FLAG_N = NFLAG_32(res);
 
@@ -556,7 +561,7 @@
 #define FLAGS_NEGX_32()														\
 	FLAG_Z |= ZFLAG_32(res);												\
 	FLAG_V = (res & src) >> 24;												\
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);							\
+	FLAG_X = FLAG_C = CFLAG_NEGX_32(src, res);								\
 	FLAG_N = NFLAG_32(res);
 
 #define FLAGS_NEG_8()														\
@@ -1091,16 +1096,16 @@
 {																			\
 	EA_READ_I(16, NA, res)													\
 	EA_##mode(NA, Y)														\
-	src = (UINT32)(&D0);													\
+	reg = &D0;																\
 	dst = adr;																\
 	do																		\
 	{																		\
 		if (res & 1)														\
 		{																	\
-			WRITE_MEM_##size(adr, *(u##size *)src);							\
+			WRITE_MEM_##size(adr, *(u##size *)reg);							\
 			adr += (size / 8);												\
 		}																	\
-		src += 4;															\
+		reg++;																\
 	} while (res >>= 1);													\
 	RET(MOVEM_CLOCKS_RE_##mode + ((adr - dst) << 1))						\
 }
@@ -1109,16 +1114,16 @@
 {																			\
 	EA_READ_I(16, NA, res)													\
 	adr = A##y;																\
-	src = (UINT32)(&A7);													\
+	reg = &A7;																\
 	dst = adr;																\
 	do																		\
 	{																		\
 		if (res & 1)														\
 		{																	\
 			adr -= (size / 8);												\
-			WRITE_MEM_##size##PD(adr, *(u##size *)src);						\
+			WRITE_MEM_##size##PD(adr, *(u##size *)reg);						\
 		}																	\
-		src -= 4;															\
+		reg--;																\
 	} while (res >>= 1);													\
 	A##y = adr;																\
 	RET(MOVEM_CLOCKS_RE_PD + ((dst - adr) << 1))							\
@@ -1128,16 +1133,16 @@
 {																			\
 	EA_READ_I(16, NA, res)													\
 	EA_##mode(NA, Y)														\
-	src = (UINT32)(&D0);													\
+	reg = &D0;																\
 	dst = adr;																\
 	do																		\
 	{																		\
 		if (res & 1)														\
 		{																	\
-			*(INT32 *)src = READSX_##mode(size, NA);						\
+			*(INT32 *)reg = READSX_##mode(size, NA);						\
 			adr += (size / 8);												\
 		}																	\
-		src += 4;															\
+		reg++;																\
 	} while (res >>= 1);													\
 	RET(MOVEM_CLOCKS_ER_##mode + ((adr - dst) << 1))						\
 }
@@ -1146,16 +1151,16 @@
 {																			\
 	EA_READ_I(16, NA, res)													\
 	adr = A##y;																\
-	src = (UINT32)(&D0);													\
+	reg = &D0;																\
 	dst = adr;																\
 	do																		\
 	{																		\
 		if (res & 1)														\
 		{																	\
-			*(INT32 *)src = READSX_MEM_##size(adr);							\
+			*(INT32 *)reg = READSX_MEM_##size(adr);							\
 			adr += (size / 8);												\
 		}																	\
-		src += 4;															\
+		reg++;																\
 	} while (res >>= 1);													\
 	A##y = adr;																\
 	RET(MOVEM_CLOCKS_ER_PI + ((adr - dst) << 1))							\
@@ -3,6 +3,7 @@
 #include "m68000_intf.h"
 #include "m68000_debug.h"
 #include <retro_inline.h>
+#include <stddef.h>
 
 #ifdef EMU_M68K
 INT32 nSekM68KContextSize[SEK_MAX];
@@ -22,6 +23,16 @@ INT32 nSekCyclesTotal, nSekCyclesScanline, nSekCyclesSegment, nSekCyclesDone, nS
 
 INT32 nSekCPUType[SEK_MAX], nSekCycles[SEK_MAX], nSekIRQPending[SEK_MAX];
 
+#ifdef EMU_M68K
+INT32 nSekCpuCore = SEK_CORE_M68K;				// The 68000 emulator all cpus use
+#else
+INT32 nSekCpuCore = SEK_CORE_C68K;
+#endif
+
+#ifdef EMU_M68K
+static INT32 nSekDecodeCPU = -1;					// The cpu whose code is in Musashi's decode cache
+#endif
+
 #if defined (FBA_DEBUG)
 
 void (*SekDbgBreakpointHandlerRead)(UINT32, INT32);
@@ -566,6 +577,16 @@ unsigned int __fastcall M68KFetchByte(unsigned int a) { return (unsigned int)Fet
 unsigned int __fastcall M68KFetchWord(unsigned int a) { return (unsigned int)FetchWord(a); }
 unsigned int __fastcall M68KFetchLong(unsigned int a) { return               FetchLong(a); }
 
+#if M68K_DECODE_PAGE_BITS > SEK_BITS
+ #error The decode cache pages must not be bigger than the memory map pages
+#endif
+
+// Only code in memory which the 68000 can't write to is kept decoded
+int M68KDecodeCacheable(unsigned int a)
+{
+	return (uintptr_t)FIND_F(a) >= SEK_MAXHANDLER && (uintptr_t)FIND_W(a) < SEK_MAXHANDLER;
+}
+
 #ifdef FBA_DEBUG
 UINT32 __fastcall M68KReadByteBP(UINT32 a) { return (UINT32)ReadByteBP(a); }
 UINT32 __fastcall M68KReadWordBP(UINT32 a) { return (UINT32)ReadWordBP(a); }
@@ -600,11 +621,37 @@ UINT16 C68KFetchWord(UINT32 a) { return FetchWord(a); }
 void C68KWriteByte(UINT32 a, UINT8 d) { WriteByte(a, d); }
 void C68KWriteWord(UINT32 a, UINT16 d) { WriteWord(a, d); }
 
-UINT32 C68KRebasePC(UINT32 pc)
+// C68K reads opcodes straight from the host pointer. For code in a page with
+// handlers, the longest instruction (5 words) from the PC on is read through the
+// fetch handlers into a buffer of the CPU's own, and LimitPC makes C68K come
+// back here for the next instruction. So such code runs an instruction at a
+// time, and sees changes made behind the handlers, but is slow.
+#define C68K_HANDLER_WORDS	(8)
+
+static UINT16 C68KHandlerCode[SEK_MAX][C68K_HANDLER_WORDS];
+
+static uintptr_t C68KRebase(c68k_struc *pContext, INT32 nCPU, UINT32 pc)
 {
+   UINT8* pr;
+   INT32 i;
+
    pc &= 0xFFFFFF;
-   SekC68KCurrentContext->BasePC = (UINT32)FIND_F(pc) - (pc & ~SEK_PAGEM);
-   return SekC68KCurrentContext->BasePC + pc;
+   pr = FIND_F(pc);
+   if ((uintptr_t)pr < SEK_MAXHANDLER) {
+      for (i = 0; i < C68K_HANDLER_WORDS; i++)
+         C68KHandlerCode[nCPU][i] = BURN_ENDIAN_SWAP_INT16(FetchWord((pc + (i << 1)) & 0xFFFFFF));
+      pContext->BasePC = (uintptr_t)C68KHandlerCode[nCPU] - pc;
+      pContext->LimitPC = (uintptr_t)C68KHandlerCode[nCPU] + 1;
+   } else {
+      pContext->BasePC = (uintptr_t)pr - (pc & ~SEK_PAGEM);
+      pContext->LimitPC = ~(uintptr_t)0;
+   }
+   return pContext->BasePC + pc;
+}
+
+uintptr_t C68KRebasePC(UINT32 pc)
+{
+   return C68KRebase(SekC68KCurrentContext, nSekActive, pc);
 }
 
 INT32 C68KInterruptCallBack(INT32 irqline)
@@ -782,6 +829,221 @@ void M68KcmpildCallback(unsigned int val, int reg)
 }
 #endif
 
+// ----------------------------------------------------------------------------
+// Idle loop skipping
+
+#ifdef EMU_M68K
+// A short loop ending in a backward Bcc or BRA, whose other instructions only
+// test or compare memory and registers (or load data registers from memory),
+// does exactly the same thing each time round until the memory it reads is
+// changed. If that memory is RAM or ROM (no handlers), nothing else can change
+// it before the timeslice ends. So once the loop has been seen going round,
+// the whole times round left in the timeslice are skipped at once, leaving the
+// CPU in the same state as running them would have.
+
+#define SEK_IDLE_CACHE		(64)				// Loops remembered, by the address of the branch
+#define SEK_IDLE_LENGTH		(32)				// Longest loop checked, in bytes
+#define SEK_IDLE_OPERANDS	(4)					// Most memory operands in a loop
+#define SEK_IDLE_ABS		(8)					// Operand at an absolute address
+#define SEK_IDLE_PCREL		(9)					// Operand at a PC relative address (read through the fetch map)
+
+INT32 nM68KIdleSkip = 0;
+
+struct SekIdleLoop {
+	UINT32 nPC;									// Address of the branch (0 if unused)
+	INT32 nCycles;								// Cycles each time round, 0 if the loop can't be skipped
+	INT32 nLast;								// SekTotalCycles() when the branch was last taken
+	INT32 nOperands;
+	struct {
+		INT32 nReg;								// Address register the operand is relative to, or SEK_IDLE_ABS/PCREL
+		UINT32 nAddress;
+		INT32 nSize;
+	} Operand[SEK_IDLE_OPERANDS];
+};
+
+static struct SekIdleLoop SekIdleLoops[SEK_IDLE_CACHE];
+
+// Step *pnAddress past the extension words of effective address nEA, and note
+// any memory it reads. Returns nonzero for modes with side effects (or not handled)
+static INT32 SekIdleOperand(struct SekIdleLoop *pl, UINT32 *pnAddress, INT32 nEA, INT32 nSize)
+{
+	UINT32 a = *pnAddress;
+	INT32 nReg = nEA & 7;
+	UINT32 nOffset = 0;
+
+	switch (nEA >> 3) {
+		case 0:									// Dn
+		case 1:									// An
+			return 0;
+		case 2:									// (An)
+			break;
+		case 5:									// (d16,An)
+			nOffset = (INT16)FetchWord(a);
+			a += 2;
+			break;
+		case 7:
+			switch (nReg) {
+				case 0:							// (xxx).W
+					nOffset = (INT16)FetchWord(a);
+					nReg = SEK_IDLE_ABS;
+					a += 2;
+					break;
+				case 1:							// (xxx).L
+					nOffset = FetchLong(a);
+					nReg = SEK_IDLE_ABS;
+					a += 4;
+					break;
+				case 2:							// (d16,PC)
+					nOffset = a + (INT16)FetchWord(a);
+					nReg = SEK_IDLE_PCREL;
+					a += 2;
+					break;
+				case 4:							// #imm
+					*pnAddress = a + (nSize == 4 ? 4 : 2);
+					return 0;
+				default:
+					return 1;
+			}
+			break;
+		default:								// (An)+, -(An), (d8,An,Xn)
+			return 1;
+	}
+
+	if (pl->nOperands >= SEK_IDLE_OPERANDS)
+		return 1;
+
+	pl->Operand[pl->nOperands].nReg = nReg;
+	pl->Operand[pl->nOperands].nAddress = nOffset;
+	pl->Operand[pl->nOperands].nSize = nSize;
+	pl->nOperands++;
+
+	*pnAddress = a;
+	return 0;
+}
+
+// Check the loop from nStart to the branch at nPC. Returns nonzero if it can't be skipped
+static INT32 SekIdleLoopCheck(struct SekIdleLoop *pl, UINT32 nStart, UINT32 nPC)
+{
+	UINT32 a;
+	UINT32 nOp = FetchWord(nPC);
+	INT32 nCycles;
+
+	pl->nOperands = 0;
+
+	// Bcc or BRA (not BSR or DBcc)
+	if ((nOp & 0xF000) != 0x6000 || (nOp & 0x0F00) == 0x0100)
+		return 1;
+	if (nPC - nStart > SEK_IDLE_LENGTH)
+		return 1;
+	// Code in RAM could change (the PC can be outside the 24 bit bus)
+	nStart &= 0xFFFFFF;
+	nPC &= 0xFFFFFF;
+	if ((uintptr_t)FIND_W(nStart) >= SEK_MAXHANDLER || (uintptr_t)FIND_W(nPC) >= SEK_MAXHANDLER)
+		return 1;
+
+	a = nStart;
+	nCycles = m68k_instruction_cycles(nOp);
+
+	while (a < nPC) {
+		INT32 nSize;
+
+		nOp = FetchWord(a);
+		a += 2;
+		nCycles += m68k_instruction_cycles(nOp);
+
+		if ((nOp & 0xFF00) == 0x4A00 && (nOp & 0x00C0) != 0x00C0) {				// TST <ea>
+			nSize = 1 << ((nOp >> 6) & 3);
+		} else if ((nOp & 0xFF00) == 0x0C00 && (nOp & 0x00C0) != 0x00C0) {		// CMPI #imm,<ea>
+			nSize = 1 << ((nOp >> 6) & 3);
+			a += nSize == 4 ? 4 : 2;
+		} else if ((nOp & 0xFFC0) == 0x0800) {									// BTST #n,<ea>
+			nSize = 1;
+			a += 2;
+		} else if ((nOp & 0xF1C0) == 0x0100 && (nOp & 0x0038) != 0x0008) {		// BTST Dn,<ea>
+			nSize = 1;
+		} else if ((nOp & 0xF000) == 0xB000 && ((nOp >> 6) & 7) < 3) {			// CMP <ea>,Dn
+			nSize = 1 << ((nOp >> 6) & 3);
+		} else if ((nOp & 0xF0C0) == 0xB0C0) {									// CMPA <ea>,An
+			nSize = (nOp & 0x0100) ? 4 : 2;
+		} else if ((nOp & 0xC1C0) == 0x0000 && (nOp & 0x3000) && (nOp & 0x0038) >= 0x0010) {	// MOVE <mem>,Dn
+			nSize = (nOp & 0x3000) == 0x1000 ? 1 : ((nOp & 0x3000) == 0x3000 ? 2 : 4);
+		} else {
+			return 1;
+		}
+
+		if (SekIdleOperand(pl, &a, nOp & 0x3F, nSize))
+			return 1;
+	}
+
+	if (a != nPC)
+		return 1;
+
+	pl->nCycles = nCycles;
+	return 0;
+}
+
+void M68KBranchBackCallback(unsigned int pc)
+{
+	struct SekIdleLoop *pl = SekIdleLoops + ((pc >> 1) & (SEK_IDLE_CACHE - 1));
+	INT32 nTotal = SekTotalCycles();
+	INT32 i, nSkip;
+
+	if (pl->nPC != pc) {
+		pl->nPC = pc;
+		pl->nCycles = 0;
+		pl->nLast = nTotal;
+		SekIdleLoopCheck(pl, m68k_get_reg(NULL, M68K_REG_PC), pc);
+		return;
+	}
+
+	if (pl->nCycles == 0)
+		return;
+
+	// Only once the CPU has just gone round the loop and nothing else, all in
+	// this timeslice (memory can be changed between timeslices)
+	if (nTotal - pl->nLast != pl->nCycles || pl->nLast < nSekCyclesTotal) {
+		pl->nLast = nTotal;
+		return;
+	}
+
+	for (i = 0; i < pl->nOperands; i++) {
+		UINT32 a = pl->Operand[i].nAddress;
+		UINT32 e;
+
+		if (pl->Operand[i].nReg < 8)
+			a += m68k_get_reg(NULL, (m68k_register_t)(M68K_REG_A0 + pl->Operand[i].nReg));
+		a &= 0xFFFFFF;
+		e = (a + pl->Operand[i].nSize - 1) & 0xFFFFFF;
+
+		if (pl->Operand[i].nReg == SEK_IDLE_PCREL) {
+			if ((uintptr_t)FIND_F(a) < SEK_MAXHANDLER || (uintptr_t)FIND_F(e) < SEK_MAXHANDLER) {
+				pl->nLast = nTotal;
+				return;
+			}
+		} else {
+			if ((uintptr_t)FIND_R(a) < SEK_MAXHANDLER || (uintptr_t)FIND_R(e) < SEK_MAXHANDLER) {
+				pl->nLast = nTotal;
+				return;
+			}
+		}
+	}
+
+	// Go round as many times as will still end with cycles left, as running them would
+	nSkip = (m68k_ICount - 1) / pl->nCycles;
+	m68k_ICount -= nSkip * pl->nCycles;
+
+	pl->nLast = SekTotalCycles();
+}
+#endif
+
+void SekSetIdleSkip(INT32 bEnable)
+{
+#ifdef EMU_M68K
+	nM68KIdleSkip = bEnable;
+	memset(SekIdleLoops, 0, sizeof(SekIdleLoops));
+#endif
+}
+
 // ----------------------------------------------------------------------------
 // Initialisation/exit/reset
 
@@ -922,6 +1184,24 @@ INT32 SekInit(INT32 nCount, INT32 nCPUType)
 	if (nCount > nSekCount)
 		nSekCount = nCount;
 
+	// C68K and the recompiler only do the 68000, so anything else runs on Musashi
+#if defined(EMU_M68K) && (defined(EMU_C68K) || defined(EMU_M68K_DRC))
+	if (nCount == 0 && nCPUType != 0x68000)
+		nSekCpuCore = SEK_CORE_M68K;
+#if !defined(EMU_C68K)
+	if (nSekCpuCore == SEK_CORE_C68K)
+		nSekCpuCore = SEK_CORE_M68K;
+#endif
+#if !defined(EMU_M68K_DRC)
+	if (nSekCpuCore == SEK_CORE_DRC)
+		nSekCpuCore = SEK_CORE_M68K;
+#endif
+#elif defined(EMU_M68K)
+	nSekCpuCore = SEK_CORE_M68K;
+#else
+	nSekCpuCore = SEK_CORE_C68K;
+#endif
+
 	// Allocate cpu extenal data (memory map etc)
 	SekExt[nCount] = (struct SekExt*)malloc(sizeof(struct SekExt));
 	if (SekExt[nCount] == NULL) {
@@ -1033,20 +1313,28 @@ INT32 SekInit(INT32 nCount, INT32 nCPUType)
    {
 #endif
 
-#if defined(EMU_M68K)
+#ifdef EMU_M68K
+	if (SEK_CORE_MUSASHI)
+   {
 		m68k_init();
 		if (SekInitCPUM68K(nCount, nCPUType))
       {
 			SekExit();
 			return 1;
 		}
-#elif defined(EMU_C68K)
+	}
+#endif
+
+#ifdef EMU_C68K
+	if (nSekCpuCore == SEK_CORE_C68K)
+   {
       if(SekInitCPUC68K(nCount, nCPUType))
       {
          SekExit();
          return 1;
       }
       C68k_Init( SekC68KCurrentContext );
+   }
 #endif
 
 #ifdef EMU_A68K
@@ -1120,11 +1408,19 @@ INT32 SekExit(void)
 #ifdef EMU_C68K
    C68k_Exit();
 #endif
+#ifdef EMU_M68K_DRC
+	m68k_drc_exit();
+#endif
 
 	pSekExt = NULL;
 
 	nSekActive = -1;
 	nSekCount = -1;
+
+	SekSetIdleSkip(0);
+#ifdef EMU_M68K
+	nSekDecodeCPU = -1;
+#endif
 	
 	return 0;
 }
@@ -1141,10 +1437,14 @@ void SekReset()
 	} else {
 #endif
 
-#if defined(EMU_M68K)
-		m68k_pulse_reset();
-#elif defined(EMU_C68K)
-      C68k_Reset( SekC68KCurrentContext );
+#ifdef EMU_M68K
+		if (SEK_CORE_MUSASHI)
+			m68k_pulse_reset();
+#endif
+
+#ifdef EMU_C68K
+		if (nSekCpuCore == SEK_CORE_C68K)
+			C68k_Reset( SekC68KCurrentContext );
 #endif
 
 
@@ -1175,10 +1475,22 @@ void SekOpen(const INT32 i)
       {
 #endif
 
-#if defined(EMU_M68K)
-			m68k_set_context(SekM68KContext[nSekActive]);
-#elif defined(EMU_C68K)
-         SekC68KCurrentContext = SekC68KContext[nSekActive];
+#ifdef EMU_M68K
+			if (SEK_CORE_MUSASHI) {
+				m68k_set_context(SekM68KContext[nSekActive]);
+				if (nSekDecodeCPU != nSekActive) {
+					m68k_decode_cache_flush();
+#ifdef EMU_M68K_DRC
+					m68k_drc_flush();
+#endif
+					nSekDecodeCPU = nSekActive;
+				}
+			}
+#endif
+
+#ifdef EMU_C68K
+			if (nSekCpuCore == SEK_CORE_C68K)
+				SekC68KCurrentContext = SekC68KContext[nSekActive];
 #endif
 
 #ifdef EMU_A68K
@@ -1199,7 +1511,8 @@ void SekClose()
 #endif
 
 #ifdef EMU_M68K
-		m68k_get_context(SekM68KContext[nSekActive]);
+		if (SEK_CORE_MUSASHI)
+			m68k_get_context(SekM68KContext[nSekActive]);
 #endif
 
 #ifdef EMU_A68K
@@ -1234,12 +1547,17 @@ void SekSetIRQLine(const INT32 line, const INT32 status)
 		} else {
 #endif
 
-#if defined(EMU_M68K)
-         m68k_set_irq(line);
-#elif defined(EMU_C68K)
-         SekC68KCurrentContext->IRQState = 1;	//ASSERT_LINE
-         SekC68KCurrentContext->IRQLine = line;
-         SekC68KCurrentContext->HaltState = 0;
+#ifdef EMU_M68K
+		if (SEK_CORE_MUSASHI)
+			m68k_set_irq(line);
+#endif
+
+#ifdef EMU_C68K
+		if (nSekCpuCore == SEK_CORE_C68K) {
+			SekC68KCurrentContext->IRQState = 1;	//ASSERT_LINE
+			SekC68KCurrentContext->IRQLine = line;
+			SekC68KCurrentContext->HaltState = 0;
+		}
 #endif
 
 #ifdef EMU_A68K
@@ -1257,11 +1575,16 @@ void SekSetIRQLine(const INT32 line, const INT32 status)
 	} else {
 #endif
 
-#if defined(EMU_M68K)
+#ifdef EMU_M68K
+	if (SEK_CORE_MUSASHI)
 		m68k_set_irq(0);
-#elif defined(EMU_C68K)
-      SekC68KCurrentContext->IRQState = 0;	//CLEAR_LINE
+#endif
+
+#ifdef EMU_C68K
+	if (nSekCpuCore == SEK_CORE_C68K) {
+		SekC68KCurrentContext->IRQState = 0;	//CLEAR_LINE
 		SekC68KCurrentContext->IRQLine = 0;
+	}
 #endif
 
 #ifdef EMU_A68K
@@ -1273,7 +1596,13 @@ void SekSetIRQLine(const INT32 line, const INT32 status)
 // Adjust the active CPU's timeslice
 void SekRunAdjust(const INT32 nCycles)
 {
-#if defined(EMU_A68K) || defined(EMU_M68K)
+#if defined(SEK_ICOUNT)
+	if (nCycles < 0 && SEK_ICOUNT < -nCycles)
+   {
+		SekRunEnd();
+		return;
+	}
+#elif defined(EMU_A68K)
 	if (nCycles < 0 && m68k_ICount < -nCycles)
    {
 		SekRunEnd();
@@ -1289,18 +1618,19 @@ void SekRunAdjust(const INT32 nCycles)
 	} else {
 #endif
 
-#if defined(EMU_M68K)
-      nSekCyclesToDo += nCycles;
-      m68k_modify_timeslice(nCycles);
-#elif defined(EMU_C68K)
-      if (nCycles < 0 && c68k_ICount < -nCycles)
-      {
-         SekRunEnd();
-         return;
-      }
-      nSekCyclesToDo += nCycles;
-      c68k_ICount += nCycles;
-      nSekCyclesSegment += nCycles;
+#ifdef EMU_M68K
+		if (SEK_CORE_MUSASHI) {
+			nSekCyclesToDo += nCycles;
+			m68k_modify_timeslice(nCycles);
+		}
+#endif
+
+#ifdef EMU_C68K
+		if (nSekCpuCore == SEK_CORE_C68K) {
+			nSekCyclesToDo += nCycles;
+			c68k_ICount += nCycles;
+			nSekCyclesSegment += nCycles;
+		}
 #endif
 
 #ifdef EMU_A68K
@@ -1322,13 +1652,18 @@ void SekRunEnd(void)
 	} else {
 #endif
 
-#if defined(EMU_M68K)
-		m68k_end_timeslice();
-#elif defined(EMU_C68K)
-      nSekCyclesTotal += (nSekCyclesToDo - nSekCyclesDone) - c68k_ICount;
-      nSekCyclesDone += (nSekCyclesToDo - nSekCyclesDone) - c68k_ICount;
-      nSekCyclesSegment = nSekCyclesDone;
-      nSekCyclesToDo = c68k_ICount = -1;
+#ifdef EMU_M68K
+		if (SEK_CORE_MUSASHI)
+			m68k_end_timeslice();
+#endif
+
+#ifdef EMU_C68K
+		if (nSekCpuCore == SEK_CORE_C68K) {
+			nSekCyclesTotal += (nSekCyclesToDo - nSekCyclesDone) - c68k_ICount;
+			nSekCyclesDone += (nSekCyclesToDo - nSekCyclesDone) - c68k_ICount;
+			nSekCyclesSegment = nSekCyclesDone;
+			nSekCyclesToDo = c68k_ICount = -1;
+		}
 #endif
 
 #ifdef EMU_A68K
@@ -1366,26 +1701,43 @@ INT32 SekRun(const INT32 nCycles)
 	} else {
 #endif
 
-#if defined(EMU_M68K)
-		nSekCyclesToDo = nCycles;
+#ifdef EMU_M68K
+		if (SEK_CORE_MUSASHI) {
+			BURN_PROF_ENTER(BURN_PROF_SEK);
+			nSekCyclesToDo = nCycles;
+
+#ifdef EMU_M68K_DRC
+			if (nSekCpuCore == SEK_CORE_DRC)
+				nSekCyclesSegment = m68k_drc_execute(nCycles);
+			else
+#endif
+			nSekCyclesSegment = m68k_execute(nCycles);
 
-		nSekCyclesSegment = m68k_execute(nCycles);
+			nSekCyclesTotal += nSekCyclesSegment;
+			nSekCyclesToDo = m68k_ICount = -1;
+			BURN_PROF_LEAVE();
 
-		nSekCyclesTotal += nSekCyclesSegment;
-		nSekCyclesToDo = m68k_ICount = -1;
+			return nSekCyclesSegment;
+		}
+#endif
+
+#ifdef EMU_C68K
+		if (nSekCpuCore == SEK_CORE_C68K) {
+			BURN_PROF_ENTER(BURN_PROF_SEK);
+			nSekCyclesToDo = nCycles;
 
-		return nSekCyclesSegment;
-#elif defined(EMU_C68K)
-      nSekCyclesToDo = nCycles;
-		nSekCyclesSegment = C68k_Exec(SekC68KCurrentContext, nCycles);
-		nSekCyclesTotal += nSekCyclesSegment;
-		nSekCyclesToDo = c68k_ICount = -1;
+			nSekCyclesSegment = C68k_Exec(SekC68KCurrentContext, nCycles);
 
-		return nSekCyclesSegment;
-#else
-		return 0;
+			nSekCyclesTotal += nSekCyclesSegment;
+			nSekCyclesToDo = c68k_ICount = -1;
+			BURN_PROF_LEAVE();
+
+			return nSekCyclesSegment;
+		}
 #endif
 
+		return 0;
+
 #ifdef EMU_A68K
 	}
 #endif
@@ -1565,6 +1917,13 @@ INT32 SekMapMemory(UINT8* pMemory, UINT32 nStart, UINT32 nEnd, INT32 nType)
 	Ptr     = pMemory - nStart;
 	pMemMap = pSekExt->MemMap + (nStart >> SEK_SHIFT);
 
+#ifdef EMU_M68K
+	m68k_decode_cache_flush();						// The code may have changed
+#endif
+#ifdef EMU_M68K_DRC
+	m68k_drc_invalidate(nStart, nEnd);
+#endif
+
 	// Special case for ROM banks
 	if (nType == SM_ROM)
    {
@@ -1596,6 +1955,13 @@ INT32 SekMapHandler(uintptr_t nHandler, UINT32 nStart, UINT32 nEnd, INT32 nType)
 
 	pMemMap = pSekExt->MemMap + (nStart >> SEK_SHIFT);
 
+#ifdef EMU_M68K
+	m68k_decode_cache_flush();						// The code may have changed
+#endif
+#ifdef EMU_M68K_DRC
+	m68k_drc_invalidate(nStart, nEnd);
+#endif
+
 	// Add to memory map
 	for (i = (nStart & ~SEK_PAGEM); i <= nEnd; i += SEK_PAGE_SIZE, pMemMap++) {
 
@@ -1716,14 +2082,18 @@ UINT32 SekGetPC(INT32 n)
 	} else {
 #endif
 
-#if defined(EMU_M68K)
-		return m68k_get_reg(NULL, M68K_REG_PC);
-#elif defined(EMU_C68K)
-      return SekC68KCurrentContext->PC - SekC68KCurrentContext->BasePC;
-#else
-		return 0;
+#ifdef EMU_M68K
+		if (SEK_CORE_MUSASHI)
+			return m68k_get_reg(NULL, M68K_REG_PC);
+#endif
+
+#ifdef EMU_C68K
+		if (nSekCpuCore == SEK_CORE_C68K)
+			return (UINT32)(SekC68KCurrentContext->PC - SekC68KCurrentContext->BasePC);
 #endif
 
+		return 0;
+
 #ifdef EMU_A68K
 	}
 #endif
@@ -1810,7 +2180,8 @@ UINT32 SekDbgGetRegister(enum SekRegister nRegister)
 	}
 #endif
 
-#if defined(EMU_M68K)
+#ifdef EMU_M68K
+	if (SEK_CORE_MUSASHI)
 	switch (nRegister)
    {
       case SEK_REG_D0:
@@ -1878,7 +2249,10 @@ UINT32 SekDbgGetRegister(enum SekRegister nRegister)
       default:
          return 0;
    }
-#elif defined(EMU_C68K)
+#endif
+
+#ifdef EMU_C68K
+   if (nSekCpuCore == SEK_CORE_C68K)
    switch (nRegister)
    {
       case SEK_REG_D0:
@@ -1916,7 +2290,7 @@ UINT32 SekDbgGetRegister(enum SekRegister nRegister)
          return SekC68KCurrentContext->A[7];
 
       case SEK_REG_PC:
-         return SekC68KCurrentContext->PC - SekC68KCurrentContext->BasePC;
+         return (UINT32)(SekC68KCurrentContext->PC - SekC68KCurrentContext->BasePC);
 
       case SEK_REG_SR:
          return 0;
@@ -1941,6 +2315,8 @@ UINT32 SekDbgGetRegister(enum SekRegister nRegister)
          return 0;
    }
 #endif
+
+   return 0;
 }
 
 BOOL SekDbgSetRegister(enum SekRegister nRegister, UINT32 nValue)
@@ -2078,8 +2454,8 @@ INT32 SekScan(INT32 nAction)
 		} else {
 #endif
 
-#if defined(EMU_M68K)
-			if (nSekCPUType[i] != 0) {
+#ifdef EMU_M68K
+			if (SEK_CORE_MUSASHI && nSekCPUType[i] != 0) {
 				ba.Data = SekM68KContext[i];
 
             // for savestate portability: preserve our cpu's pointers, they are set up in DrvInit() and can be specific to different systems.
@@ -2088,18 +2464,21 @@ INT32 SekScan(INT32 nAction)
             ba.szName = szName;
 				BurnAcb(&ba);
 			}
-#elif defined(EMU_C68K)
-         // PC must contain regular m68000 value
-         SekC68KContext[i]->PC -= SekC68KContext[i]->BasePC;
-
-         ba.Data = SekC68KContext[i];
-         ba.nLen = (UINT32)&(SekC68KContext[i]->BasePC) - (UINT32)SekC68KContext[i];
-         ba.szName = szName;
-         BurnAcb(&ba);
-
-         // restore pointer in PC
-         SekC68KContext[i]->BasePC = (UINT32)FIND_F(SekC68KContext[i]->PC) - (SekC68KContext[i]->PC & ~SEK_PAGEM);
-         SekC68KContext[i]->PC += SekC68KContext[i]->BasePC;
+#endif
+
+#ifdef EMU_C68K
+			if (nSekCpuCore == SEK_CORE_C68K) {
+				// PC must contain regular m68000 value
+				SekC68KContext[i]->PC -= SekC68KContext[i]->BasePC;
+
+				ba.Data = SekC68KContext[i];
+				ba.nLen = offsetof(c68k_struc, BasePC);
+				ba.szName = szName;
+				BurnAcb(&ba);
+
+				// restore pointer in PC
+				SekC68KContext[i]->PC = C68KRebase(SekC68KContext[i], i, SekC68KContext[i]->PC);
+			}
 #endif
 
 #ifdef EMU_A68K
@@ -16,7 +16,7 @@ extern "C" {
 #endif
 
 //#define EMU_M68K								// Use Musashi 68000 emulator
-//#define EMU_C68K
+//#define EMU_C68K								// Use C68K 68000 emulator (68000 only)
 
 #define SEK_MAX	(4)								// Maximum number of CPUs supported
 
@@ -82,6 +82,22 @@ void __cdecl M68000_RESET(void);
 #define c68k_ICount	(SekC68KCurrentContext->ICount)
 #endif
 
+// With more than one built in, the core is picked at run time
+#define SEK_CORE_C68K	(0)
+#define SEK_CORE_M68K	(1)
+#define SEK_CORE_DRC	(2)							// Musashi, running translated blocks
+#define SEK_CORE_MUSASHI	(nSekCpuCore != SEK_CORE_C68K)
+
+extern INT32 nSekCpuCore;						// Set by the application before SekInit
+
+#if defined(EMU_M68K) && defined(EMU_C68K)
+ #define SEK_ICOUNT	(nSekCpuCore == SEK_CORE_C68K ? c68k_ICount : m68k_ICount)
+#elif defined(EMU_M68K)
+ #define SEK_ICOUNT	(m68k_ICount)
+#elif defined(EMU_C68K)
+ #define SEK_ICOUNT	(c68k_ICount)
+#endif
+
 
 typedef UINT8 (__fastcall *pSekReadByteHandler)(UINT32 a);
 typedef void (__fastcall *pSekWriteByteHandler)(UINT32 a, UINT8 d);
@@ -163,6 +179,10 @@ void SekRunEnd(void);
 void SekRunAdjust(const INT32 nCycles);
 INT32 SekRun(const INT32 nCycles);
 
+// Skip the rest of the timeslice in idle loops (Musashi only, see m68000_intf.c).
+// Only for machines where RAM is changed by nothing but the 68000 during a timeslice
+void SekSetIdleSkip(INT32 bEnable);
+
 static INLINE INT32 SekIdle(INT32 nCycles)
 {
    nSekCyclesTotal += nCycles;
@@ -172,10 +192,8 @@ static INLINE INT32 SekIdle(INT32 nCycles)
 
 static INLINE INT32 SekSegmentCycles(void)
 {
-#if defined(EMU_M68K)
-	return nSekCyclesDone + nSekCyclesToDo - m68k_ICount;
-#elif defined(EMU_C68K)
-   return nSekCyclesDone + nSekCyclesToDo - c68k_ICount;
+#if defined(SEK_ICOUNT)
+	return nSekCyclesDone + nSekCyclesToDo - SEK_ICOUNT;
 #else
 	return nSekCyclesDone + nSekCyclesToDo;
 #endif
@@ -187,10 +205,8 @@ static INT32 SekTotalCycles(void)
 static INLINE INT32 SekTotalCycles(void)
 #endif
 {
-#if defined(EMU_M68K)
-	return nSekCyclesTotal + nSekCyclesToDo - m68k_ICount;
-#elif defined(EMU_C68K)
-   return nSekCyclesTotal + nSekCyclesToDo - c68k_ICount;
+#if defined(SEK_ICOUNT)
+	return nSekCyclesTotal + nSekCyclesToDo - SEK_ICOUNT;
 #else
 	return nSekCyclesTotal + nSekCyclesToDo;
 #endif
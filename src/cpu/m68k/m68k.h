@@ -301,6 +301,18 @@ int m68k_cycles_run(void);              /* Number of cycles run so far */
 int m68k_cycles_remaining(void);        /* Number of cycles left */
 void m68k_modify_timeslice(int cycles); /* Modify cycles left */
 void m68k_end_timeslice(void);          /* End timeslice now */
+int m68k_instruction_cycles(unsigned int instruction); /* Base cycles of an opcode */
+
+/* Forget the opcodes kept by the decode cache (see M68K_DECODE_CACHE) */
+void m68k_decode_cache_flush(void);
+
+#if defined(EMU_M68K_DRC)
+/* The same as m68k_execute(), running translated blocks (see m68kdrc.c) */
+int m68k_drc_execute(int num_cycles);
+void m68k_drc_flush(void);                                 /* Forget all blocks */
+void m68k_drc_invalidate(unsigned int start, unsigned int end); /* The code in a range may have changed */
+void m68k_drc_exit(void);                                  /* Free the blocks */
+#endif /* EMU_M68K_DRC */
 
 /* Set the IPL0-IPL2 pins on the CPU (IRQ).
  * A transition from < 7 to 7 will cause a non-maskable interrupt (NMI).
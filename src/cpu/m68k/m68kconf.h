@@ -103,6 +103,12 @@
 //#define M68K_RTE_CALLBACK()         your_rte_handler_function()
 #define M68K_RTE_CALLBACK()	    M68KRTECallback()
 
+/* If ON, CPU will call the callback when it takes a backward 8 or 16 bit
+ * branch (Bcc, BRA, BSR, DBcc), with the address of the branch instruction.
+ */
+#define M68K_BRANCH_BACK_HAS_CALLBACK OPT_SPECIFY_HANDLER
+#define M68K_BRANCH_BACK_CALLBACK(A)  { if (nM68KIdleSkip) M68KBranchBackCallback(A); }
+
 
 /* If ON, CPU will call the set fc callback on every memory access to
  * differentiate between user/supervisor, program/data access like a real
@@ -137,6 +143,18 @@
 #define M68K_EMULATE_PREFETCH       OPT_ON
 
 
+/* If ON, opcodes fetched from addresses where M68K_DECODE_CACHEABLE(A) is
+ * true are kept in a small cache with their handler and cycle count, keyed
+ * by the PC, so running them again skips the fetch and the table lookups.
+ * Call m68k_decode_cache_flush() whenever the memory at those addresses
+ * changes. M68K_DECODE_CACHEABLE(A) must give the same answer for every
+ * address in a page of 1 << M68K_DECODE_PAGE_BITS bytes.
+ */
+#define M68K_DECODE_CACHE           OPT_ON
+#define M68K_DECODE_CACHEABLE(A)    M68KDecodeCacheable(A)
+#define M68K_DECODE_PAGE_BITS       10
+
+
 /* If ON, the CPU will generate address error exceptions if it tries to
  * access a word or longword at an odd address.
  * NOTE: This is only emulated properly for 68000 mode.
@@ -191,6 +209,9 @@ void M68KResetCallback(void);
 int M68KIRQAcknowledge(int nIRQ);
 void M68KRTECallback(void);
 void M68KcmpildCallback(unsigned int val, int reg);
+extern int nM68KIdleSkip;
+void M68KBranchBackCallback(unsigned int pc);
+int M68KDecodeCacheable(unsigned int a);
 
 unsigned int __fastcall M68KFetchByte(unsigned int a);
 unsigned int __fastcall M68KFetchWord(unsigned int a);
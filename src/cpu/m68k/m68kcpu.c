@@ -32,6 +32,23 @@ uint    m68ki_aerr_address;
 uint    m68ki_aerr_write_mode;
 uint    m68ki_aerr_fc;
 
+#if M68K_DECODE_CACHE
+/* Opcodes already fetched and looked up, direct mapped by PC */
+#define M68K_DECODE_CACHE_SIZE 4096
+
+typedef struct
+{
+	void (*handler)(void); /* Opcode handler */
+	uint pc;               /* Address of the opcode */
+	uint pref_data;        /* Prefetch queue after fetching the opcode */
+	uint16 ir;             /* The opcode */
+	uint16 cycles;         /* Base cycles of the opcode */
+} m68ki_decode_entry;
+
+static m68ki_decode_entry m68ki_decode_cache[M68K_DECODE_CACHE_SIZE];
+static uint m68ki_decode_skip_page = ~0; /* Page last found not to be cacheable */
+#endif /* M68K_DECODE_CACHE */
+
 /* Used by shift & rotate instructions */
 uint8 m68ki_shift_8_table[65] =
 {
@@ -538,6 +555,9 @@ void m68k_set_instr_hook_callback(void  (*callback)(void))
 /* Set the CPU type. */
 void m68k_set_cpu_type(unsigned int cpu_type)
 {
+	/* Cached cycle counts are for the old type */
+	m68k_decode_cache_flush();
+
 	switch(cpu_type)
 	{
 		case M68K_CPU_TYPE_68000:
@@ -623,6 +643,63 @@ void m68k_set_cpu_type(unsigned int cpu_type)
 	}
 }
 
+#if M68K_DECODE_CACHE
+/* Fetch an instruction and call its handler, through the decode cache */
+static INLINE void m68ki_decode_execute(void)
+{
+	m68ki_decode_entry* entry = m68ki_decode_cache + ((REG_PC >> 1) & (M68K_DECODE_CACHE_SIZE - 1));
+	uint pc = REG_PC;
+
+	if(entry->pc == pc)
+	{
+		/* Leave the prefetch queue as the fetch would have */
+		CPU_PREF_ADDR = MASK_OUT_BELOW_2(pc);
+		CPU_PREF_DATA = entry->pref_data;
+		REG_PC += 2;
+		REG_IR = entry->ir;
+		entry->handler();
+		USE_CYCLES(entry->cycles);
+		return;
+	}
+
+	REG_IR = m68ki_read_imm_16();
+
+	/* Fill the entry before running the opcode, which may change the memory map.
+	 * Code running from RAM would ask on every opcode, so remember the page */
+	if(!(pc & 1) && (ADDRESS_68K(pc) >> M68K_DECODE_PAGE_BITS) != m68ki_decode_skip_page)
+	{
+		if(M68K_DECODE_CACHEABLE(ADDRESS_68K(pc)))
+		{
+			entry->handler   = m68ki_instruction_jump_table[REG_IR];
+			entry->pc        = pc;
+			entry->pref_data = CPU_PREF_DATA;
+			entry->ir        = REG_IR;
+			entry->cycles    = CYC_INSTRUCTION[REG_IR];
+		}
+		else
+			m68ki_decode_skip_page = ADDRESS_68K(pc) >> M68K_DECODE_PAGE_BITS;
+	}
+
+	m68ki_instruction_jump_table[REG_IR]();
+	USE_CYCLES(CYC_INSTRUCTION[REG_IR]);
+}
+#endif /* M68K_DECODE_CACHE */
+
+void m68k_decode_cache_flush(void)
+{
+#if M68K_DECODE_CACHE
+	uint i;
+
+	/* An address which belongs in a different entry never matches */
+	for(i = 0; i < M68K_DECODE_CACHE_SIZE; i++)
+	{
+		m68ki_decode_cache[i].pc = (i ^ 1) << 1;
+		m68ki_decode_cache[i].handler = NULL;
+	}
+	m68ki_decode_skip_page = ~0;
+#endif /* M68K_DECODE_CACHE */
+}
+
 /* Execute some instructions until we use up num_cycles clock cycles */
 /* ASG: removed per-instruction interrupt checks */
 int m68k_execute(int num_cycles)
@@ -657,9 +734,13 @@ int m68k_execute(int num_cycles)
 			REG_PPC = REG_PC;
 
 			/* Read an instruction and call its handler */
+#if M68K_DECODE_CACHE
+			m68ki_decode_execute();
+#else
 			REG_IR = m68ki_read_imm_16();
 			m68ki_instruction_jump_table[REG_IR]();
 			USE_CYCLES(CYC_INSTRUCTION[REG_IR]);
+#endif /* M68K_DECODE_CACHE */
 
 			/* Trace m68k_exception, if necessary */
 			m68ki_exception_if_trace(); /* auto-disable (see m68kcpu.h) */
@@ -694,6 +775,11 @@ int m68k_cycles_remaining(void)
 	return GET_CYCLES();
 }
 
+int m68k_instruction_cycles(unsigned int instruction)
+{
+	return CYC_INSTRUCTION[instruction & 0xffff];
+}
+
 /* Change the timeslice */
 void m68k_modify_timeslice(int cycles)
 {
@@ -467,6 +467,12 @@
 	#define m68ki_rte_callback()
 #endif /* M68K_RTE_HAS_CALLBACK */
 
+#if M68K_BRANCH_BACK_HAS_CALLBACK
+	#define m68ki_branch_back_callback() M68K_BRANCH_BACK_CALLBACK(REG_PPC)
+#else
+	#define m68ki_branch_back_callback()
+#endif /* M68K_BRANCH_BACK_HAS_CALLBACK */
+
 #if M68K_INSTRUCTION_HOOK
 	#if M68K_INSTRUCTION_HOOK == OPT_SPECIFY_HANDLER
 		#define m68ki_instr_hook() M68K_INSTRUCTION_CALLBACK()
@@ -871,6 +877,7 @@ typedef struct
 
 extern m68ki_cpu_core m68ki_cpu;
 extern sint           m68ki_remaining_cycles;
+extern sint           m68ki_initial_cycles;
 extern uint           m68ki_tracing;
 extern uint8          m68ki_shift_8_table[];
 extern uint16         m68ki_shift_16_table[];
@@ -1381,11 +1388,15 @@ static INLINE void m68ki_jump_vector(uint vector)
 static INLINE void m68ki_branch_8(uint offset)
 {
 	REG_PC += MAKE_INT_8(offset);
+	if(offset & 0x80)
+		m68ki_branch_back_callback();
 }
 
 static INLINE void m68ki_branch_16(uint offset)
 {
 	REG_PC += MAKE_INT_16(offset);
+	if(offset & 0x8000)
+		m68ki_branch_back_callback();
 }
 
 static INLINE void m68ki_branch_32(uint offset)
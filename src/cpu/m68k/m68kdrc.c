@@ -0,0 +1,2053 @@
+/* ======================================================================== */
+/* ============================ BLOCK RECOMPILER ========================== */
+/* ======================================================================== */
+/*
+ * Translates runs of 68000 code into x86-64 host code, for the same
+ * m68ki_cpu state the interpreter uses, so the two can be mixed freely.
+ *
+ * A block starts at an opcode and runs up to the first instruction which
+ * changes the PC in a way not known when translating (or up to
+ * DRC_BLOCK_INSNS instructions).  Common instructions are translated in
+ * line, anything else calls its handler from the jump table like
+ * m68k_execute() does.  Cycles are taken off m68ki_remaining_cycles after
+ * every instruction, and the block leaves as soon as they run out, so
+ * timeslices end on the same instruction as with the interpreter.
+ *
+ * Memory accesses look up the Sek page tables in line and call the page's
+ * handler when there is one.  A handler may end the timeslice, raise an
+ * interrupt or change the memory map; the block checks drc_break after
+ * the instruction and returns to m68k_drc_execute() if the PC or the code
+ * changed under it.
+ *
+ * Only pages M68K_DECODE_CACHEABLE() says hold fixed code are translated,
+ * the same rule the decode cache uses, and m68k_drc_invalidate() must be
+ * called when the memory map of those pages changes.
+ */
+
+#if defined(EMU_M68K_DRC)
+
+#if !defined(__x86_64__) && !defined(_M_X64)
+#error The 68000 recompiler only has an x86-64 back end
+#endif
+
+#include <stddef.h>
+#include <string.h>
+#include <stdlib.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+#include "burnint.h"
+#include "m68000_intf.h"
+#include "m68kops.h"
+#include "m68kcpu.h"
+
+/* ======================================================================== */
+/* ============================ CONFIGURATION ============================= */
+/* ======================================================================== */
+
+#define DRC_CODE_SIZE   (8 << 20)             /* Host code buffer */
+#define DRC_CODE_SPARE  (256 << 10)           /* Flush when less than this is left */
+#define DRC_BLOCK_INSNS 64                    /* Most instructions in a block */
+#define DRC_BLOCK_CODE  (32 << 10)            /* End a block once its code is this big */
+#define DRC_MAX_EXITS   256                   /* Most exits from a block */
+#define DRC_MAX_SLOW    256                   /* Most memory handler calls in a block */
+#define DRC_PAGE_BITS   M68K_DECODE_PAGE_BITS
+#define DRC_PAGES       (1 << (24 - DRC_PAGE_BITS))
+#define DRC_SLOTS       (1 << (DRC_PAGE_BITS - 1))
+
+/* Addressing modes, as bits: modes 0-6, then 7.0-7.4 as bits 7-11 */
+#define DRC_EA_ALL        0xfff
+#define DRC_EA_DATA       0xffd
+#define DRC_EA_CONTROL    0x7e4
+#define DRC_EA_ALTER      0x1ff
+#define DRC_EA_DATA_ALTER 0x1fd
+#define DRC_EA_MEM_ALTER  0x1fc
+#define DRC_EA_IMM        0x800
+
+/* Memory maps and handler tables of the Sek interface */
+#define DRC_READ  0
+#define DRC_WRITE 1
+#define DRC_FETCH 2
+
+/* What a read-modify-write instruction does with the flags */
+#define DRC_ARITH      0                      /* XNZVC, set before the write */
+#define DRC_LOGIC      1                      /* NZ, V and C cleared, before the write */
+#define DRC_LOGIC_LAST 2                      /* The same after the write */
+
+/* Host registers */
+enum { RAX, RCX, RDX, RBX, RSP, RBP, RSI, RDI, R8, R9, R10, R11, R12, R13, R14, R15 };
+
+#define RCPU  R15                             /* &m68ki_cpu */
+#define RICNT R14                             /* &m68ki_remaining_cycles */
+#define RMAP  R13                             /* pSekExt */
+#define RBRK  R12                             /* &drc_break */
+#ifdef _WIN32
+#define RARG0 RCX
+#define RARG1 RDX
+#define DRC_FRAME 40                          /* Shadow space, keeps rsp aligned */
+#else
+#define RARG0 RDI
+#define RARG1 RSI
+#define DRC_FRAME 8
+#endif
+
+/* Host conditions */
+enum { X86_O, X86_NO, X86_B, X86_AE, X86_E, X86_NE, X86_BE, X86_A,
+       X86_S, X86_NS, X86_P, X86_NP, X86_L, X86_GE, X86_LE, X86_G };
+
+/* ALU operations, shifts and bit tests */
+enum { X_ADD, X_OR, X_ADC, X_SBB, X_AND, X_SUB, X_XOR, X_CMP };
+enum { X_ROL, X_ROR, X_RCL, X_RCR, X_SHL, X_SHR, X_SAL, X_SAR };
+enum { X_BT, X_BTC, X_BTR, X_BTS };
+
+#define X86_SZ(S, OP)   ((S) == 1 ? (OP) - 1 : (OP))
+#define DRC_OFS(F)      ((int)offsetof(m68ki_cpu_core, F))
+#define DRC_DA(N)       (DRC_OFS(dar) + (N) * 4)
+#define DRC_D(N)        DRC_DA(N)
+#define DRC_A(N)        DRC_DA((N) + 8)
+
+
+/* ======================================================================== */
+/* ================================= DATA ================================= */
+/* ======================================================================== */
+
+typedef struct
+{
+	uint8* from;      /* End of the jump to patch */
+	uint pc;          /* PC to leave with */
+	uint pref;        /* Address of the last word read */
+	uint ir;          /* The opcode */
+	int cycles;       /* Cycles still to take */
+	int brk;          /* Leaving because of drc_break */
+} drc_exit_t;
+
+typedef struct
+{
+	uint8* from;      /* End of the jump to patch */
+	uint8* back;      /* Where to carry on */
+	uint pc;          /* REG_PC at the access */
+	uint ppc;         /* Address of the instruction */
+	int kind;         /* DRC_READ, DRC_WRITE or DRC_FETCH */
+	int size;
+	uint move;        /* MOVE to finish in drc_move_moved() if the PC moved, or 0 */
+	uint pref;        /* Address of the last word read, for the MOVE */
+} drc_slow_t;
+
+static uint8* drc_code;                       /* Host code buffer */
+static uint8* drc_ptr;                        /* Where the next code goes */
+static uint8* drc_blocks;                     /* Blocks start here, after the stubs */
+static int drc_failed;                        /* No code buffer, use the interpreter */
+
+static void (*drc_enter)(void* block);        /* Runs a block */
+static uint8* drc_exit;                       /* Back to m68k_drc_execute() */
+static uint8* drc_dispatch;                   /* Goes on at REG_PC */
+
+static void** drc_page[DRC_PAGES];            /* Block of each opcode, by page */
+static uint8 drc_page_used[DRC_PAGES];        /* A block starts in the page */
+static uint8 drc_page_code[DRC_PAGES];        /* A block was translated from the page */
+static uint8 drc_break;                       /* 1: the blocks are gone, 2: the PC changed */
+static uint drc_skip_page = ~0;               /* Page last found not to be translatable */
+
+/* Translation state */
+static uint drc_pc;                           /* Next word to read */
+static uint drc_op_pc;                        /* Address of the instruction */
+static uint drc_op;                           /* The opcode */
+static uint drc_pref;                         /* Last word read */
+static int drc_abort;                         /* Instruction crosses into a page not translated */
+static int drc_callouts;                      /* Instruction may call a memory handler */
+
+static drc_exit_t drc_exits[DRC_MAX_EXITS];
+static int drc_exit_count;
+static drc_slow_t drc_slows[DRC_MAX_SLOW];
+static int drc_slow_count;
+
+
+/* ======================================================================== */
+/* =============================== EMITTER ================================ */
+/* ======================================================================== */
+
+static void x86_byte(uint value)
+{
+	*drc_ptr++ = (uint8)value;
+}
+
+static void x86_long(uint value)
+{
+	memcpy(drc_ptr, &value, 4);
+	drc_ptr += 4;
+}
+
+static void x86_imm(int size, uint value)
+{
+	x86_byte(value);
+	if(size >= 2)
+		x86_byte(value >> 8);
+	if(size >= 4)
+	{
+		x86_byte(value >> 16);
+		x86_byte(value >> 24);
+	}
+}
+
+/* Prefixes, opcode and ModRM.  With mem, rm is [rm + index << scale + disp]
+ * (no index if it is negative), otherwise a register.  byteregs asks for a
+ * REX prefix so registers 4-7 are spl-dil rather than ah-bh.
+ */
+static void x86_code(int size, int byteregs, int op, int reg, int rm, int index, int scale, int disp, int mem)
+{
+	int rex = (size == 8 ? 8 : 0) | (reg & 8 ? 4 : 0) | (index >= 0 && (index & 8) ? 2 : 0) | (rm & 8 ? 1 : 0);
+	int mod;
+
+	if(byteregs && ((reg & ~3) == 4 || (!mem && (rm & ~3) == 4)))
+		rex |= 0x40;
+	if(size == 2)
+		x86_byte(0x66);
+	if(rex)
+		x86_byte(0x40 | rex);
+	if(op > 0xff)
+		x86_byte(op >> 8);
+	x86_byte(op);
+
+	if(!mem)
+	{
+		x86_byte(0xc0 | (reg & 7) << 3 | (rm & 7));
+		return;
+	}
+
+	mod = (disp == 0 && (rm & 7) != 5) ? 0 : (disp == (sint8)disp) ? 1 : 2;
+	if(index >= 0 || (rm & 7) == 4)
+	{
+		x86_byte(mod << 6 | (reg & 7) << 3 | 4);
+		x86_byte(scale << 6 | ((index >= 0 ? index : 4) & 7) << 3 | (rm & 7));
+	}
+	else
+		x86_byte(mod << 6 | (reg & 7) << 3 | (rm & 7));
+	if(mod == 1)
+		x86_byte(disp);
+	else if(mod == 2)
+		x86_long(disp);
+}
+
+#define x86_rr(S, OP, R, RM)         x86_code(S, (S) == 1, OP, R, RM, -1, 0, 0, 0)
+#define x86_rm(S, OP, R, B, D)       x86_code(S, (S) == 1, OP, R, B, -1, 0, D, 1)
+
+static void x86_mov_rr(int size, int dst, int src)
+{
+	x86_rr(size, X86_SZ(size, 0x89), src, dst);
+}
+
+static void x86_load(int size, int reg, int base, int disp)
+{
+	x86_rm(size, X86_SZ(size, 0x8b), reg, base, disp);
+}
+
+static void x86_store(int size, int base, int disp, int reg)
+{
+	x86_rm(size, X86_SZ(size, 0x89), reg, base, disp);
+}
+
+static void x86_store_imm(int size, int base, int disp, uint value)
+{
+	x86_rm(size, X86_SZ(size, 0xc7), 0, base, disp);
+	x86_imm(size, value);
+}
+
+/* movzx/movsx from a byte or word register or memory */
+static void x86_ext_rr(int size, int sign, int dst, int src)
+{
+	x86_code(4, size == 1, (sign ? 0x0fbe : 0x0fb6) | (size == 2), dst, src, -1, 0, 0, 0);
+}
+
+static void x86_load_ext(int size, int sign, int reg, int base, int disp)
+{
+	if(size == 4)
+		x86_load(4, reg, base, disp);
+	else
+		x86_code(4, 0, (sign ? 0x0fbe : 0x0fb6) | (size == 2), reg, base, -1, 0, disp, 1);
+}
+
+static void x86_mov_ri(int reg, uint value)
+{
+	if(reg & 8)
+		x86_byte(0x41);
+	x86_byte(0xb8 | (reg & 7));
+	x86_long(value);
+}
+
+static void x86_mov_ri64(int reg, const void* ptr)
+{
+	uintptr_t value = (uintptr_t)ptr;
+
+	x86_byte(reg & 8 ? 0x49 : 0x48);
+	x86_byte(0xb8 | (reg & 7));
+	memcpy(drc_ptr, &value, 8);
+	drc_ptr += 8;
+}
+
+static void x86_alu_imm(int size, int op, int rm, int disp, int mem, uint value)
+{
+	sint imm = size == 1 ? (sint8)value : size == 2 ? (sint16)value : (sint)value;
+
+	if(size == 1)
+	{
+		x86_code(1, 1, 0x80, op, rm, -1, 0, disp, mem);
+		x86_byte(value);
+	}
+	else if(imm == (sint8)imm)
+	{
+		x86_code(size, 0, 0x83, op, rm, -1, 0, disp, mem);
+		x86_byte(imm);
+	}
+	else
+	{
+		x86_code(size, 0, 0x81, op, rm, -1, 0, disp, mem);
+		x86_imm(size, value);
+	}
+}
+
+#define x86_alu_ri(S, OP, R, V)      x86_alu_imm(S, OP, R, 0, 0, V)
+#define x86_alu_mi(S, OP, B, D, V)   x86_alu_imm(S, OP, B, D, 1, V)
+
+/* reg op= reg, reg op= [base + disp] and [base + disp] op= reg */
+static void x86_alu_rr(int size, int op, int dst, int src)
+{
+	x86_rr(size, X86_SZ(size, op << 3 | 1), src, dst);
+}
+
+static void x86_alu_rm(int size, int op, int reg, int base, int disp)
+{
+	x86_rm(size, X86_SZ(size, op << 3 | 3), reg, base, disp);
+}
+
+static void x86_alu_mr(int size, int op, int base, int disp, int reg)
+{
+	x86_rm(size, X86_SZ(size, op << 3 | 1), reg, base, disp);
+}
+
+static void x86_shift_ri(int size, int op, int reg, int count)
+{
+	x86_rr(size, X86_SZ(size, 0xc1), op, reg);
+	x86_byte(count);
+}
+
+static void x86_not(int size, int reg)
+{
+	x86_rr(size, X86_SZ(size, 0xf7), 2, reg);
+}
+
+static void x86_neg(int size, int reg)
+{
+	x86_rr(size, X86_SZ(size, 0xf7), 3, reg);
+}
+
+static void x86_test_ri(int size, int reg, uint value)
+{
+	x86_rr(size, X86_SZ(size, 0xf7), 0, reg);
+	x86_imm(size, value);
+}
+
+static void x86_test_rr(int size, int dst, int src)
+{
+	x86_rr(size, X86_SZ(size, 0x85), src, dst);
+}
+
+static void x86_test_mi(int size, int base, int disp, uint value)
+{
+	x86_rm(size, X86_SZ(size, 0xf7), 0, base, disp);
+	x86_imm(size, value);
+}
+
+static void x86_imul(int dst, int src)
+{
+	x86_rr(4, 0x0faf, dst, src);
+}
+
+static void x86_bt_ri(int op, int reg, int bit)
+{
+	static const int ext[] = { 4, 7, 6, 5 };
+
+	x86_rr(4, 0x0fba, ext[op], reg);
+	x86_byte(bit);
+}
+
+static void x86_bt_rr(int op, int reg, int bit)
+{
+	static const int code[] = { 0x0fa3, 0x0fbb, 0x0fb3, 0x0fab };
+
+	x86_rr(4, code[op], bit, reg);
+}
+
+static void x86_setcc(int cc, int reg)
+{
+	x86_code(4, 1, 0x0f90 | cc, 0, reg, -1, 0, 0, 0);
+}
+
+static void x86_push(int reg)
+{
+	if(reg & 8)
+		x86_byte(0x41);
+	x86_byte(0x50 | (reg & 7));
+}
+
+static void x86_pop(int reg)
+{
+	if(reg & 8)
+		x86_byte(0x41);
+	x86_byte(0x58 | (reg & 7));
+}
+
+/* Jumps return the end of their displacement, for x86_patch() */
+static uint8* x86_jcc(int cc)
+{
+	x86_byte(0x0f);
+	x86_byte(0x80 | cc);
+	x86_long(0);
+	return drc_ptr;
+}
+
+static uint8* x86_jmp(void)
+{
+	x86_byte(0xe9);
+	x86_long(0);
+	return drc_ptr;
+}
+
+static void x86_patch(uint8* from, const uint8* to)
+{
+	sint rel = (sint)(to - from);
+
+	memcpy(from - 4, &rel, 4);
+}
+
+static void x86_jcc_to(int cc, const uint8* to)
+{
+	x86_patch(x86_jcc(cc), to);
+}
+
+static void x86_jmp_to(const uint8* to)
+{
+	x86_patch(x86_jmp(), to);
+}
+
+static void x86_call(const void* func)
+{
+	x86_mov_ri64(RAX, func);
+	x86_rr(4, 0xff, 2, RAX);
+}
+
+static void x86_jmp_rax(void)
+{
+	x86_rr(4, 0xff, 4, RAX);
+}
+
+
+/* ======================================================================== */
+/* ================================ STUBS ================================= */
+/* ======================================================================== */
+
+#ifdef _WIN32
+static const int drc_saved[] = { RBX, RBP, RSI, RDI, R12, R13, R14, R15 };
+#else
+static const int drc_saved[] = { RBX, RBP, R12, R13, R14, R15 };
+#endif
+#define DRC_SAVED ((int)(sizeof(drc_saved) / sizeof(drc_saved[0])))
+
+/* Entry, exit and the jump to the block at REG_PC, kept across flushes */
+static void drc_emit_stubs(void)
+{
+	uint8* fail;
+	uint8* none;
+	int i;
+
+	drc_enter = (void (*)(void*))drc_ptr;
+	for(i = 0; i < DRC_SAVED; i++)
+		x86_push(drc_saved[i]);
+	x86_alu_ri(8, X_SUB, RSP, DRC_FRAME);
+	x86_mov_ri64(RCPU, &m68ki_cpu);
+	x86_mov_ri64(RICNT, &m68ki_remaining_cycles);
+	x86_mov_ri64(RMAP, &pSekExt);
+	x86_load(8, RMAP, RMAP, 0);
+	x86_mov_ri64(RBRK, &drc_break);
+	x86_rr(4, 0xff, 4, RARG0);
+
+	drc_exit = drc_ptr;
+	x86_alu_ri(8, X_ADD, RSP, DRC_FRAME);
+	for(i = DRC_SAVED - 1; i >= 0; i--)
+		x86_pop(drc_saved[i]);
+	x86_byte(0xc3);
+
+	drc_dispatch = drc_ptr;
+	x86_load(4, RAX, RCPU, DRC_OFS(pc));
+	x86_test_ri(4, RAX, 0xff000001);
+	x86_jcc_to(X86_NE, drc_exit);
+	x86_mov_rr(4, RCX, RAX);
+	x86_shift_ri(4, X_SHR, RCX, DRC_PAGE_BITS);
+	x86_mov_ri64(RDX, drc_page);
+	x86_code(8, 0, 0x8b, RDX, RDX, RCX, 3, 0, 1);
+	x86_test_rr(8, RDX, RDX);
+	fail = x86_jcc(X86_E);
+	x86_alu_ri(4, X_AND, RAX, (1 << DRC_PAGE_BITS) - 2);
+	x86_code(8, 0, 0x8b, RAX, RDX, RAX, 2, 0, 1);
+	x86_test_rr(8, RAX, RAX);
+	none = x86_jcc(X86_E);
+	x86_jmp_rax();
+	x86_patch(fail, drc_exit);
+	x86_patch(none, drc_exit);
+}
+
+
+/* ======================================================================== */
+/* ============================ BLOCK TABLES ============================== */
+/* ======================================================================== */
+
+/* The block for an opcode, if there is one */
+static INLINE void* drc_lookup(uint pc)
+{
+	void** page;
+
+	if(pc & 0xff000001)
+		return NULL;
+	page = drc_page[pc >> DRC_PAGE_BITS];
+	return page ? page[(pc & ((1 << DRC_PAGE_BITS) - 1)) >> 1] : NULL;
+}
+
+/* Where the block for an opcode goes, or NULL if it can't have one */
+static void** drc_slot(uint pc)
+{
+	uint page = pc >> DRC_PAGE_BITS;
+
+	/* Blocks are for 24 bit PCs */
+	if((pc & 0xff000000) || !M68K_DECODE_CACHEABLE(pc))
+	{
+		drc_skip_page = page;
+		return NULL;
+	}
+	if(pc & 1)
+		return NULL;
+	if(!drc_page[page])
+	{
+		drc_page[page] = (void**)calloc(DRC_SLOTS, sizeof(void*));
+		if(!drc_page[page])
+			return NULL;
+	}
+	return drc_page[page] + ((pc & ((1 << DRC_PAGE_BITS) - 1)) >> 1);
+}
+
+void m68k_drc_flush(void)
+{
+	int i;
+
+	if(!drc_code)
+		return;
+
+	for(i = 0; i < DRC_PAGES; i++)
+		if(drc_page_used[i])
+			memset(drc_page[i], 0, DRC_SLOTS * sizeof(void*));
+	memset(drc_page_used, 0, sizeof(drc_page_used));
+	memset(drc_page_code, 0, sizeof(drc_page_code));
+	drc_skip_page = ~0;
+	drc_ptr = drc_blocks;
+
+	/* A block running now carries on from code which is still there, but
+	 * leaves after the current instruction */
+	drc_break = 1;
+}
+
+void m68k_drc_invalidate(unsigned int start, unsigned int end)
+{
+	uint page;
+
+	/* The page may be translatable now */
+	drc_skip_page = ~0;
+
+	if(!drc_code)
+		return;
+
+	for(page = (start & 0xffffff) >> DRC_PAGE_BITS; page <= (end & 0xffffff) >> DRC_PAGE_BITS; page++)
+		if(drc_page_code[page])
+		{
+			m68k_drc_flush();
+			return;
+		}
+}
+
+void m68k_drc_exit(void)
+{
+	int i;
+
+	for(i = 0; i < DRC_PAGES; i++)
+	{
+		free(drc_page[i]);
+		drc_page[i] = NULL;
+	}
+	memset(drc_page_used, 0, sizeof(drc_page_used));
+	memset(drc_page_code, 0, sizeof(drc_page_code));
+	drc_skip_page = ~0;
+
+	if(drc_code)
+	{
+#ifdef _WIN32
+		VirtualFree(drc_code, 0, MEM_RELEASE);
+#else
+		munmap(drc_code, DRC_CODE_SIZE);
+#endif
+	}
+	drc_code = NULL;
+	drc_failed = 0;
+}
+
+static int drc_init(void)
+{
+#ifdef _WIN32
+	drc_code = (uint8*)VirtualAlloc(NULL, DRC_CODE_SIZE, MEM_COMMIT | MEM_RESERVE, PAGE_EXECUTE_READWRITE);
+#else
+	drc_code = (uint8*)mmap(NULL, DRC_CODE_SIZE, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if(drc_code == (uint8*)MAP_FAILED)
+		drc_code = NULL;
+#endif
+	if(!drc_code)
+	{
+		drc_failed = 1;
+		return 0;
+	}
+
+	drc_ptr = drc_code;
+	drc_emit_stubs();
+	drc_blocks = drc_ptr;
+	return 1;
+}
+
+
+/* ======================================================================== */
+/* ========================= TRANSLATION HELPERS ========================== */
+/* ======================================================================== */
+
+/* Read the next word of the instruction */
+static uint drc_word(void)
+{
+	uint pc = ADDRESS_68K(drc_pc);
+
+	if(!M68K_DECODE_CACHEABLE(pc))
+	{
+		drc_abort = 1;
+		return 0;
+	}
+	drc_page_code[pc >> DRC_PAGE_BITS] = 1;
+	drc_pref = drc_pc;
+	drc_pc += 2;
+	return m68k_read_immediate_16(pc);
+}
+
+static uint drc_imm(int size)
+{
+	uint value = drc_word();
+
+	if(size == 4)
+		return value << 16 | drc_word();
+	return size == 1 ? MASK_OUT_ABOVE_8(value) : value;
+}
+
+static int drc_ea_ok(int mode, int reg, int allowed)
+{
+	int bit = mode < 7 ? mode : 7 + reg;
+
+	return bit < 12 && (allowed >> bit & 1);
+}
+
+/* Leave the block: REG_PC is pc, the prefetch queue holds the last word read */
+static void drc_exit_add(uint8* from, uint pc, int cycles, int brk)
+{
+	drc_exit_t* exit = drc_exits + drc_exit_count++;
+
+	exit->from = from;
+	exit->pc = pc;
+	exit->pref = drc_pref;
+	exit->ir = drc_op;
+	exit->cycles = cycles;
+	exit->brk = brk;
+}
+
+static void drc_emit_exits(void)
+{
+	int i;
+
+	for(i = 0; i < drc_exit_count; i++)
+	{
+		drc_exit_t* exit = drc_exits + i;
+		uint pref = MASK_OUT_BELOW_2(exit->pref);
+
+		x86_patch(exit->from, drc_ptr);
+		if(exit->cycles)
+			x86_alu_mi(4, X_SUB, RICNT, 0, exit->cycles);
+		x86_store_imm(4, RCPU, DRC_OFS(pref_addr), pref);
+		x86_store_imm(4, RCPU, DRC_OFS(pref_data), m68k_read_immediate_32(ADDRESS_68K(pref)));
+		x86_store_imm(4, RCPU, DRC_OFS(ir), exit->ir);
+		if(exit->brk)
+		{
+			x86_alu_mi(1, X_CMP, RBRK, 0, 2);
+			x86_jcc_to(X86_E, drc_exit);
+		}
+		x86_store_imm(4, RCPU, DRC_OFS(pc), exit->pc);
+		x86_jmp_to(drc_exit);
+	}
+}
+
+/* Take the cycles of an instruction and leave if they ran out */
+static void drc_end(int cycles)
+{
+	if(drc_callouts)
+	{
+		x86_alu_mi(1, X_CMP, RBRK, 0, 0);
+		drc_exit_add(x86_jcc(X86_NE), drc_pc, cycles, 1);
+	}
+	x86_alu_mi(4, X_SUB, RICNT, 0, cycles);
+	drc_exit_add(x86_jcc(X86_LE), drc_pc, 0, 0);
+}
+
+/* Go on at a PC known when translating */
+static void drc_link(uint pc)
+{
+	void** slot = drc_slot(pc);
+
+	if(!slot)
+	{
+		drc_exit_add(x86_jmp(), pc, 0, 0);
+		return;
+	}
+	drc_page_used[pc >> DRC_PAGE_BITS] = 1;
+	x86_mov_ri64(RAX, slot);
+	x86_load(8, RAX, RAX, 0);
+	x86_test_rr(8, RAX, RAX);
+	drc_exit_add(x86_jcc(X86_E), pc, 0, 0);
+	x86_jmp_rax();
+}
+
+/* A control transfer goes on at its target whatever a memory handler did
+ * before it, as the handler would.  The next block leaves if they were flushed.
+ */
+static void drc_clear_break(void)
+{
+	if(drc_callouts)
+		x86_store_imm(1, RBRK, 0, 0);
+}
+
+/* Go on at the PC in REG_PC */
+static void drc_jump(int cycles)
+{
+	uint pref = MASK_OUT_BELOW_2(drc_pref);
+
+	drc_clear_break();
+	x86_store_imm(4, RCPU, DRC_OFS(pref_addr), pref);
+	x86_store_imm(4, RCPU, DRC_OFS(pref_data), m68k_read_immediate_32(ADDRESS_68K(pref)));
+	x86_store_imm(4, RCPU, DRC_OFS(ir), drc_op);
+	x86_alu_mi(4, X_SUB, RICNT, 0, cycles);
+	x86_jcc_to(X86_LE, drc_exit);
+	x86_jmp_to(drc_dispatch);
+}
+
+#if M68K_BRANCH_BACK_HAS_CALLBACK
+static void drc_branch_back(void)
+{
+	m68ki_branch_back_callback();
+}
+#endif
+
+/* A branch taken to target, then the cycles, as m68ki_branch_8/16() */
+static void drc_branch(uint target, int back, int cycles, int self)
+{
+	drc_clear_break();
+#if M68K_BRANCH_BACK_HAS_CALLBACK
+	if(back)
+	{
+		x86_store_imm(4, RCPU, DRC_OFS(pc), target);
+		x86_store_imm(4, RCPU, DRC_OFS(ppc), drc_op_pc);
+		x86_call(drc_branch_back);
+	}
+#endif
+	if(self && target == drc_op_pc)
+		x86_store_imm(4, RICNT, 0, 0);
+	x86_alu_mi(4, X_SUB, RICNT, 0, cycles);
+	drc_exit_add(x86_jcc(X86_LE), target, 0, 0);
+	drc_link(target);
+}
+
+/* Memory access.  The address is in eax, a read returns the value in eax and
+ * a write takes it from ebp.  Only ebx and ebp are kept.
+ */
+static void drc_mem(int kind, int size)
+{
+	drc_slow_t* slow = drc_slows + drc_slow_count++;
+	int map = kind == DRC_READ ? 0 : kind == DRC_WRITE ? SEK_WADD : SEK_WADD * 2;
+
+	x86_mov_rr(4, RDX, RAX);
+	x86_alu_ri(4, X_AND, RDX, 0xffffff);
+	x86_mov_rr(4, RCX, RDX);
+	x86_shift_ri(4, X_SHR, RCX, SEK_SHIFT);
+	x86_code(8, 0, 0x8b, RCX, RMAP, RCX, 3, map * (int)sizeof(UINT8*), 1);
+	x86_alu_ri(8, X_CMP, RCX, SEK_MAXHANDLER);
+	slow->from = x86_jcc(X86_B);
+
+	if(size == 1)
+		x86_alu_ri(4, X_XOR, RDX, 1);
+	x86_alu_ri(4, X_AND, RDX, SEK_PAGEM);
+	if(kind != DRC_WRITE)
+	{
+		if(size == 4)
+		{
+			x86_code(4, 0, 0x8b, RAX, RCX, RDX, 0, 0, 1);
+			x86_shift_ri(4, X_ROL, RAX, 16);
+		}
+		else
+			x86_code(4, 0, size == 1 ? 0x0fb6 : 0x0fb7, RAX, RCX, RDX, 0, 0, 1);
+	}
+	else if(size == 4)
+	{
+		x86_mov_rr(4, RAX, RBP);
+		x86_shift_ri(4, X_ROL, RAX, 16);
+		x86_code(4, 0, 0x89, RAX, RCX, RDX, 0, 0, 1);
+	}
+	else
+		x86_code(size, 1, X86_SZ(size, 0x89), RBP, RCX, RDX, 0, 0, 1);
+
+	slow->back = drc_ptr;
+	slow->pc = drc_pc;
+	slow->ppc = drc_op_pc;
+	slow->kind = kind;
+	slow->size = size;
+	slow->move = 0;
+	drc_callouts = 1;
+}
+
+/* The rest of a MOVE whose source read took an interrupt.  The handlers read
+ * the destination's extension words from the new PC, so do the same.
+ */
+static void drc_move_moved(uint res, uint op)
+{
+	uint ea;
+
+	REG_IR = op;
+	switch((op >> 6) & 7)
+	{
+		case 5:  ea = EA_AX_DI_32(); break;
+		case 6:  ea = EA_AX_IX_32(); break;
+		default: ea = (op & 0x0200) ? EA_AL_32() : EA_AW_32(); break;
+	}
+
+	switch(op >> 12)
+	{
+		case 1:
+			m68ki_write_8(ea, res);
+			FLAG_N = NFLAG_8(res);
+			break;
+		case 3:
+			m68ki_write_16(ea, res);
+			FLAG_N = NFLAG_16(res);
+			break;
+		default:
+			m68ki_write_32(ea, res);
+			FLAG_N = NFLAG_32(res);
+			break;
+	}
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+/* The handler calls, out of line.  rcx holds the handler and edx the address */
+static void drc_emit_slows(void)
+{
+	static const int read_ofs[] = { 0, offsetof(struct SekExt, ReadByte), offsetof(struct SekExt, ReadWord), 0, offsetof(struct SekExt, ReadLong) };
+	static const int write_ofs[] = { 0, offsetof(struct SekExt, WriteByte), offsetof(struct SekExt, WriteWord), 0, offsetof(struct SekExt, WriteLong) };
+	int i;
+
+	for(i = 0; i < drc_slow_count; i++)
+	{
+		drc_slow_t* slow = drc_slows + i;
+		uint8* same;
+		uint8* moved;
+
+		/* Not over a PC an earlier access in the instruction moved */
+		x86_patch(slow->from, drc_ptr);
+		x86_alu_mi(1, X_CMP, RBRK, 0, 2);
+		moved = x86_jcc(X86_E);
+		x86_store_imm(4, RCPU, DRC_OFS(pc), slow->pc);
+		x86_store_imm(4, RCPU, DRC_OFS(ppc), slow->ppc);
+		x86_patch(moved, drc_ptr);
+		x86_code(8, 0, 0x8b, RAX, RMAP, RCX, 3, slow->kind == DRC_WRITE ? write_ofs[slow->size] : read_ofs[slow->size], 1);
+		x86_mov_rr(4, RARG0, RDX);
+		if(slow->kind == DRC_WRITE)
+		{
+			if(slow->size == 4)
+				x86_mov_rr(4, RARG1, RBP);
+			else
+				x86_ext_rr(slow->size, 0, RARG1, RBP);
+		}
+		x86_rr(4, 0xff, 2, RAX);
+		if(slow->kind != DRC_WRITE && slow->size != 4)
+			x86_ext_rr(slow->size, 0, RAX, RAX);
+
+		/* The handler may have taken an interrupt */
+		x86_alu_mi(4, X_CMP, RCPU, DRC_OFS(pc), slow->pc);
+		same = x86_jcc(X86_E);
+		x86_store_imm(1, RBRK, 0, 2);
+		if(slow->move)
+		{
+			uint pref = MASK_OUT_BELOW_2(slow->pref);
+
+			x86_store_imm(4, RCPU, DRC_OFS(pref_addr), pref);
+			x86_store_imm(4, RCPU, DRC_OFS(pref_data), m68k_read_immediate_32(ADDRESS_68K(pref)));
+			x86_mov_rr(4, RARG0, RAX);
+			x86_mov_ri(RARG1, slow->move);
+			x86_call(drc_move_moved);
+			x86_alu_mi(4, X_SUB, RICNT, 0, CYC_INSTRUCTION[slow->move]);
+			x86_jmp_to(drc_exit);
+		}
+		x86_patch(same, slow->back);
+		x86_jmp_to(slow->back);
+	}
+}
+
+/* The address of an operand into eax.  Returns 1 for PC relative modes */
+static int drc_ea(int size, int mode, int reg)
+{
+	int step = (size == 1 && reg == 7) ? 2 : size;
+	uint ext, base;
+
+	switch(mode)
+	{
+		case 2:
+			x86_load(4, RAX, RCPU, DRC_A(reg));
+			return 0;
+		case 3:
+			x86_load(4, RAX, RCPU, DRC_A(reg));
+			x86_alu_mi(4, X_ADD, RCPU, DRC_A(reg), step);
+			return 0;
+		case 4:
+			x86_load(4, RAX, RCPU, DRC_A(reg));
+			x86_alu_ri(4, X_SUB, RAX, step);
+			x86_store(4, RCPU, DRC_A(reg), RAX);
+			return 0;
+		case 5:
+			ext = drc_word();
+			x86_load(4, RAX, RCPU, DRC_A(reg));
+			if(ext)
+				x86_alu_ri(4, X_ADD, RAX, MAKE_INT_16(ext));
+			return 0;
+		case 6:
+			ext = drc_word();
+			x86_load(4, RAX, RCPU, DRC_A(reg));
+			break;
+		default:
+			switch(reg)
+			{
+				case 0:
+					x86_mov_ri(RAX, MAKE_INT_16(drc_word()));
+					return 0;
+				case 1:
+					x86_mov_ri(RAX, drc_imm(4));
+					return 0;
+				case 2:
+					base = drc_pc;
+					x86_mov_ri(RAX, base + MAKE_INT_16(drc_word()));
+					return 1;
+			}
+			base = drc_pc;
+			ext = drc_word();
+			x86_mov_ri(RAX, base);
+			break;
+	}
+
+	/* d8(An,Xn) and d8(PC,Xn) */
+	if(BIT_B(ext))
+		x86_alu_rm(4, X_ADD, RAX, RCPU, DRC_DA(ext >> 12));
+	else
+	{
+		x86_load_ext(2, 1, RCX, RCPU, DRC_DA(ext >> 12));
+		x86_alu_rr(4, X_ADD, RAX, RCX);
+	}
+	if(MASK_OUT_ABOVE_8(ext))
+		x86_alu_ri(4, X_ADD, RAX, MAKE_INT_8(ext));
+	return mode == 7;
+}
+
+/* Read an operand into eax, zero extended */
+static void drc_read_ea(int size, int mode, int reg)
+{
+	if(mode < 2)
+		x86_load_ext(size, 0, RAX, RCPU, DRC_DA(mode * 8 + reg));
+	else if(mode == 7 && reg == 4)
+		x86_mov_ri(RAX, drc_imm(size));
+	else
+		drc_mem(drc_ea(size, mode, reg) ? DRC_FETCH : DRC_READ, size);
+}
+
+/* Write ebp to an operand */
+static void drc_write_ea(int size, int mode, int reg)
+{
+	if(mode == 0)
+		x86_store(size, RCPU, DRC_D(reg), RBP);
+	else
+	{
+		drc_ea(size, mode, reg);
+		drc_mem(DRC_WRITE, size);
+	}
+}
+
+/* Read a data alterable operand into ecx, keeping its address in ebx */
+static void drc_rmw_read(int size, int mode, int reg)
+{
+	if(mode == 0)
+		x86_load(4, RCX, RCPU, DRC_D(reg));
+	else
+	{
+		drc_ea(size, mode, reg);
+		x86_mov_rr(4, RBX, RAX);
+		drc_mem(DRC_READ, size);
+		x86_mov_rr(4, RCX, RAX);
+	}
+}
+
+/* N and Z from ecx */
+static void drc_flags_nz(int size)
+{
+	if(size == 4)
+		x86_mov_rr(4, RAX, RCX);
+	else
+		x86_ext_rr(size, 0, RAX, RCX);
+	x86_store(4, RCPU, DRC_OFS(not_z_flag), RAX);
+	if(size > 1)
+		x86_shift_ri(4, X_SHR, RAX, size * 8 - 8);
+	x86_store(4, RCPU, DRC_OFS(n_flag), RAX);
+}
+
+static void drc_flags_logic(int size)
+{
+	drc_flags_nz(size);
+	x86_store_imm(4, RCPU, DRC_OFS(v_flag), 0);
+	x86_store_imm(4, RCPU, DRC_OFS(c_flag), 0);
+}
+
+/* C (and X) from the host carry, V from the host overflow, straight after the operation */
+static void drc_flags_cv(int x)
+{
+	x86_setcc(X86_B, RAX);
+	x86_setcc(X86_O, RDX);
+	x86_ext_rr(1, 0, RAX, RAX);
+	x86_shift_ri(4, X_SHL, RAX, 8);
+	x86_store(4, RCPU, DRC_OFS(c_flag), RAX);
+	if(x)
+		x86_store(4, RCPU, DRC_OFS(x_flag), RAX);
+	x86_ext_rr(1, 0, RDX, RDX);
+	x86_shift_ri(4, X_SHL, RDX, 7);
+	x86_store(4, RCPU, DRC_OFS(v_flag), RDX);
+}
+
+/* Store ecx back to the operand read by drc_rmw_read(), with the flags */
+static void drc_rmw_write(int size, int mode, int reg, int flags)
+{
+	if(flags == DRC_ARITH)
+	{
+		drc_flags_cv(1);
+		drc_flags_nz(size);
+	}
+	else if(flags == DRC_LOGIC)
+		drc_flags_logic(size);
+
+	if(mode == 0)
+		x86_store(size, RCPU, DRC_D(reg), RCX);
+	else
+	{
+		x86_mov_rr(4, RBP, RCX);
+		x86_mov_rr(4, RAX, RBX);
+		drc_mem(DRC_WRITE, size);
+		x86_mov_rr(4, RCX, RBP);
+	}
+
+	if(flags == DRC_LOGIC_LAST)
+		drc_flags_logic(size);
+}
+
+/* Test a condition.  Returns the host condition which means it is true */
+static int drc_cond(int cc)
+{
+	switch(cc)
+	{
+		case 2: case 3: /* HI, LS: C or Z */
+			x86_load(4, RDX, RCPU, DRC_OFS(c_flag));
+			x86_shift_ri(4, X_SHR, RDX, 8);
+			x86_alu_ri(4, X_AND, RDX, 1);
+			x86_alu_mi(4, X_CMP, RCPU, DRC_OFS(not_z_flag), 1);
+			x86_alu_rr(4, X_SBB, RAX, RAX);
+			x86_alu_rr(4, X_OR, RAX, RDX);
+			return cc == 2 ? X86_E : X86_NE;
+		case 4: case 5: /* CC, CS */
+			x86_test_mi(4, RCPU, DRC_OFS(c_flag), 0x100);
+			return cc == 4 ? X86_E : X86_NE;
+		case 6: case 7: /* NE, EQ */
+			x86_alu_mi(4, X_CMP, RCPU, DRC_OFS(not_z_flag), 0);
+			return cc == 6 ? X86_NE : X86_E;
+		case 8: case 9: /* VC, VS */
+			x86_test_mi(4, RCPU, DRC_OFS(v_flag), 0x80);
+			return cc == 8 ? X86_E : X86_NE;
+		case 10: case 11: /* PL, MI */
+			x86_test_mi(4, RCPU, DRC_OFS(n_flag), 0x80);
+			return cc == 10 ? X86_E : X86_NE;
+		case 12: case 13: /* GE, LT: N != V */
+			x86_load(4, RAX, RCPU, DRC_OFS(n_flag));
+			x86_alu_rm(4, X_XOR, RAX, RCPU, DRC_OFS(v_flag));
+			x86_test_ri(4, RAX, 0x80);
+			return cc == 12 ? X86_E : X86_NE;
+		default: /* GT, LE: N != V or Z */
+			x86_alu_mi(4, X_CMP, RCPU, DRC_OFS(not_z_flag), 1);
+			x86_alu_rr(4, X_SBB, RDX, RDX);
+			x86_load(4, RAX, RCPU, DRC_OFS(n_flag));
+			x86_alu_rm(4, X_XOR, RAX, RCPU, DRC_OFS(v_flag));
+			x86_alu_ri(4, X_AND, RAX, 0x80);
+			x86_alu_rr(4, X_OR, RAX, RDX);
+			return cc == 14 ? X86_E : X86_NE;
+	}
+}
+
+
+/* ======================================================================== */
+/* ============================= INSTRUCTIONS ============================= */
+/* ======================================================================== */
+
+/* The translators return 0 for an instruction they leave to its handler,
+ * 1 when the block goes on after it and 2 when it ends the block.
+ */
+
+/* BTST, BCHG, BCLR, BSET */
+static int drc_bitop(int dynamic)
+{
+	uint op = drc_op;
+	int mode = (op >> 3) & 7, reg = op & 7, type = (op >> 6) & 3;
+	int bits = mode ? 8 : 32;
+	uint bit = 0;
+
+	if(!drc_ea_ok(mode, reg, type ? DRC_EA_DATA_ALTER : dynamic ? DRC_EA_DATA : DRC_EA_DATA & ~DRC_EA_IMM))
+		return 0;
+
+	if(!dynamic)
+		bit = drc_word() & (bits - 1);
+	if(mode == 0)
+		x86_load(4, RCX, RCPU, DRC_D(reg));
+	else if(type == X_BT)
+	{
+		drc_read_ea(1, mode, reg);
+		x86_mov_rr(4, RCX, RAX);
+	}
+	else
+		drc_rmw_read(1, mode, reg);
+
+	if(dynamic)
+	{
+		x86_load(4, RDX, RCPU, DRC_D((op >> 9) & 7));
+		x86_alu_ri(4, X_AND, RDX, bits - 1);
+		x86_bt_rr(type, RCX, RDX);
+	}
+	else
+		x86_bt_ri(type, RCX, bit);
+	x86_setcc(X86_B, RAX);
+	x86_ext_rr(1, 0, RAX, RAX);
+	x86_store(4, RCPU, DRC_OFS(not_z_flag), RAX);
+
+	if(type != X_BT)
+		drc_rmw_write(mode ? 1 : 4, mode, reg, -1);
+	drc_end(CYC_INSTRUCTION[op]);
+	return 1;
+}
+
+/* ORI, ANDI, SUBI, ADDI, EORI, CMPI and the bit operations */
+static int drc_op_0(void)
+{
+	static const int ops[8] = { X_OR, X_AND, X_SUB, X_ADD, -1, X_XOR, X_CMP, -1 };
+	static const int flags[8] = { DRC_LOGIC_LAST, DRC_LOGIC, DRC_ARITH, DRC_ARITH, 0, DRC_LOGIC_LAST, 0, 0 };
+	uint op = drc_op, imm;
+	int mode = (op >> 3) & 7, reg = op & 7, type = (op >> 9) & 7, size = 1 << ((op >> 6) & 3);
+
+	if(op & 0x0100)
+		return mode == 1 ? 0 : drc_bitop(1);
+	if(type == 4)
+		return drc_bitop(0);
+	if(ops[type] < 0 || size > 4 || !drc_ea_ok(mode, reg, DRC_EA_DATA_ALTER))
+		return 0;
+	if(ops[type] == X_CMP && size == 4 && mode == 0)
+		return 0;                             /* cmpi.l #, Dn has a callback */
+
+	imm = drc_imm(size);
+	if(ops[type] == X_CMP)
+	{
+		drc_read_ea(size, mode, reg);
+		x86_mov_rr(4, RCX, RAX);
+		x86_alu_ri(size, X_SUB, RCX, imm);
+		drc_flags_cv(0);
+		drc_flags_nz(size);
+	}
+	else
+	{
+		drc_rmw_read(size, mode, reg);
+		x86_alu_ri(size, ops[type], RCX, imm);
+		drc_rmw_write(size, mode, reg, flags[type]);
+	}
+	drc_end(CYC_INSTRUCTION[op]);
+	return 1;
+}
+
+/* MOVE, MOVEA */
+static int drc_move(void)
+{
+	uint op = drc_op;
+	int size = (op >> 12) == 1 ? 1 : (op >> 12) == 3 ? 2 : 4;
+	int mode = (op >> 3) & 7, reg = op & 7, dmode = (op >> 6) & 7, dreg = (op >> 9) & 7;
+
+	if(!drc_ea_ok(mode, reg, size == 1 ? DRC_EA_DATA : DRC_EA_ALL))
+		return 0;
+
+	if(dmode == 1)
+	{
+		if(size == 1)
+			return 0;
+		drc_read_ea(size, mode, reg);
+		if(size == 2)
+			x86_ext_rr(2, 1, RAX, RAX);
+		x86_store(4, RCPU, DRC_A(dreg), RAX);
+	}
+	else
+	{
+		if(!drc_ea_ok(dmode, dreg, DRC_EA_DATA_ALTER))
+			return 0;
+		drc_read_ea(size, mode, reg);
+		if(mode >= 2 && !(mode == 7 && reg == 4) && dmode >= 5)
+		{
+			drc_slows[drc_slow_count - 1].move = op;
+			drc_slows[drc_slow_count - 1].pref = drc_pref;
+		}
+		x86_mov_rr(4, RBP, RAX);
+		drc_write_ea(size, dmode, dreg);
+		x86_mov_rr(4, RCX, RBP);
+		drc_flags_logic(size);
+	}
+	drc_end(CYC_INSTRUCTION[op]);
+	return 1;
+}
+
+/* Push ebp */
+static void drc_push_32(void)
+{
+	x86_load(4, RAX, RCPU, DRC_A(7));
+	x86_alu_ri(4, X_SUB, RAX, 4);
+	x86_store(4, RCPU, DRC_A(7), RAX);
+	drc_mem(DRC_WRITE, 4);
+}
+
+/* Work out a JMP or JSR target when it doesn't depend on the registers */
+static int drc_static_target(int mode, int reg, uint* target)
+{
+	uint base = drc_pc;
+
+	if(mode != 7 || reg > 2)
+		return 0;
+	if(reg == 0)
+		*target = MAKE_INT_16(drc_word());
+	else if(reg == 1)
+		*target = drc_imm(4);
+	else
+		*target = base + MAKE_INT_16(drc_word());
+	return 1;
+}
+
+/* JMP, JSR */
+static int drc_jmp(int jsr)
+{
+	uint op = drc_op, target = 0;
+	int mode = (op >> 3) & 7, reg = op & 7, fixed;
+
+	if(!drc_ea_ok(mode, reg, DRC_EA_CONTROL))
+		return 0;
+
+	fixed = drc_static_target(mode, reg, &target);
+	if(!fixed)
+	{
+		drc_ea(4, mode, reg);
+		x86_mov_rr(4, RBX, RAX);
+	}
+	if(jsr)
+	{
+		x86_mov_ri(RBP, drc_pc);
+		drc_push_32();
+	}
+
+	if(fixed)
+		drc_branch(target, 0, CYC_INSTRUCTION[op], !jsr);
+	else
+	{
+		uint8* skip;
+
+		x86_store(4, RCPU, DRC_OFS(pc), RBX);
+		if(!jsr)
+		{
+			x86_alu_ri(4, X_CMP, RBX, drc_op_pc);
+			skip = x86_jcc(X86_NE);
+			x86_store_imm(4, RICNT, 0, 0);
+			x86_patch(skip, drc_ptr);
+		}
+		drc_jump(CYC_INSTRUCTION[op]);
+	}
+	return 2;
+}
+
+/* MOVEM */
+static int drc_movem(void)
+{
+	uint op = drc_op, list;
+	int mode = (op >> 3) & 7, reg = op & 7, size = (op & 0x40) ? 4 : 2;
+	int load = (op & 0x0400) != 0, count = 0, i, pcrel = 0;
+
+	if(!drc_ea_ok(mode, reg, load ? 0x7ec : 0x1f4))
+		return 0;
+
+	list = drc_word();
+	if(mode == 4)
+	{
+		/* -(An) takes the registers from A7 down to D0 */
+		x86_load(4, RBX, RCPU, DRC_A(reg));
+		for(i = 0; i < 16; i++)
+			if(list & (1 << i))
+			{
+				x86_alu_ri(4, X_SUB, RBX, size);
+				x86_mov_rr(4, RAX, RBX);
+				x86_load(4, RBP, RCPU, DRC_DA(15 - i));
+				drc_mem(DRC_WRITE, size);
+				count++;
+			}
+		x86_store(4, RCPU, DRC_A(reg), RBX);
+	}
+	else
+	{
+		if(mode == 3)
+			x86_load(4, RBX, RCPU, DRC_A(reg));
+		else
+		{
+			pcrel = drc_ea(size, mode, reg);
+			x86_mov_rr(4, RBX, RAX);
+		}
+		for(i = 0; i < 16; i++)
+			if(list & (1 << i))
+			{
+				x86_mov_rr(4, RAX, RBX);
+				if(load)
+				{
+					drc_mem(pcrel ? DRC_FETCH : DRC_READ, size);
+					if(size == 2)
+						x86_ext_rr(2, 1, RAX, RAX);
+					x86_store(4, RCPU, DRC_DA(i), RAX);
+				}
+				else
+				{
+					x86_load(4, RBP, RCPU, DRC_DA(i));
+					drc_mem(DRC_WRITE, size);
+				}
+				x86_alu_ri(4, X_ADD, RBX, size);
+				count++;
+			}
+		if(mode == 3)
+			x86_store(4, RCPU, DRC_A(reg), RBX);
+	}
+	drc_end(CYC_INSTRUCTION[op] + (count << (size == 4 ? CYC_MOVEM_L : CYC_MOVEM_W)));
+	return 1;
+}
+
+/* Miscellaneous instructions */
+static int drc_op_4(void)
+{
+	uint op = drc_op;
+	int mode = (op >> 3) & 7, reg = op & 7, size = 1 << ((op >> 6) & 3);
+
+	switch(op & 0x0fc0)
+	{
+		case 0x0840:
+			if(mode == 0)
+			{
+				/* SWAP */
+				x86_load(4, RCX, RCPU, DRC_D(reg));
+				x86_shift_ri(4, X_ROL, RCX, 16);
+				x86_store(4, RCPU, DRC_D(reg), RCX);
+				drc_flags_logic(4);
+				drc_end(CYC_INSTRUCTION[op]);
+				return 1;
+			}
+			if(!drc_ea_ok(mode, reg, DRC_EA_CONTROL))
+				return 0;
+			/* PEA */
+			drc_ea(4, mode, reg);
+			x86_mov_rr(4, RBP, RAX);
+			drc_push_32();
+			drc_end(CYC_INSTRUCTION[op]);
+			return 1;
+		case 0x0880: case 0x08c0:
+		case 0x0c80: case 0x0cc0:
+			if(mode)
+				return drc_movem();
+			if(op & 0x0400)
+				return 0;
+			/* EXT */
+			x86_load_ext(size == 4 ? 1 : 2, 1, RCX, RCPU, DRC_D(reg));
+			x86_store(size == 4 ? 2 : 4, RCPU, DRC_D(reg), RCX);
+			drc_flags_logic(size == 4 ? 2 : 4);
+			drc_end(CYC_INSTRUCTION[op]);
+			return 1;
+		case 0x0e80:
+			return drc_jmp(1);
+		case 0x0ec0:
+			return drc_jmp(0);
+		case 0x0e40:
+			if(op == 0x4e71)
+			{
+				drc_end(CYC_INSTRUCTION[op]);
+				return 1;
+			}
+			if(op == 0x4e75)
+			{
+				/* RTS */
+				x86_load(4, RAX, RCPU, DRC_A(7));
+				x86_alu_mi(4, X_ADD, RCPU, DRC_A(7), 4);
+				drc_mem(DRC_READ, 4);
+				x86_store(4, RCPU, DRC_OFS(pc), RAX);
+				drc_jump(CYC_INSTRUCTION[op]);
+				return 2;
+			}
+			return 0;
+	}
+
+	if((op & 0xf1c0) == 0x41c0)
+	{
+		/* LEA */
+		if(!drc_ea_ok(mode, reg, DRC_EA_CONTROL))
+			return 0;
+		drc_ea(4, mode, reg);
+		x86_store(4, RCPU, DRC_A((op >> 9) & 7), RAX);
+		drc_end(CYC_INSTRUCTION[op]);
+		return 1;
+	}
+
+	if(size > 4 || !drc_ea_ok(mode, reg, DRC_EA_DATA_ALTER))
+		return 0;
+	switch(op & 0x0f00)
+	{
+		case 0x0200:
+			/* CLR */
+			if(mode == 0)
+				x86_store_imm(size, RCPU, DRC_D(reg), 0);
+			else
+			{
+				x86_alu_rr(4, X_XOR, RBP, RBP);
+				drc_write_ea(size, mode, reg);
+			}
+			x86_store_imm(4, RCPU, DRC_OFS(n_flag), 0);
+			x86_store_imm(4, RCPU, DRC_OFS(not_z_flag), 0);
+			x86_store_imm(4, RCPU, DRC_OFS(v_flag), 0);
+			x86_store_imm(4, RCPU, DRC_OFS(c_flag), 0);
+			break;
+		case 0x0400:
+			/* NEG */
+			drc_rmw_read(size, mode, reg);
+			x86_neg(size, RCX);
+			drc_rmw_write(size, mode, reg, DRC_ARITH);
+			break;
+		case 0x0600:
+			/* NOT */
+			drc_rmw_read(size, mode, reg);
+			x86_not(size, RCX);
+			drc_rmw_write(size, mode, reg, DRC_LOGIC_LAST);
+			break;
+		case 0x0a00:
+			/* TST */
+			drc_read_ea(size, mode, reg);
+			x86_mov_rr(4, RCX, RAX);
+			drc_flags_logic(size);
+			break;
+		default:
+			return 0;
+	}
+	drc_end(CYC_INSTRUCTION[op]);
+	return 1;
+}
+
+/* DBcc */
+static int drc_dbcc(void)
+{
+	uint op = drc_op, offset, target, next;
+	int cc = (op >> 8) & 15, reg = op & 7, cycles = CYC_INSTRUCTION[op];
+	uint8* cond = NULL;
+	uint8* expired;
+	uint8* done;
+
+	if(cc == 0)
+	{
+		/* DBT skips the displacement without reading it */
+		drc_pc += 2;
+		drc_end(cycles);
+		return 1;
+	}
+
+	offset = drc_word();
+	target = drc_op_pc + 2 + MAKE_INT_16(offset);
+	next = drc_pc;
+
+	if(cc != 1)
+		cond = x86_jcc(drc_cond(cc));
+	x86_load(4, RCX, RCPU, DRC_D(reg));
+	x86_alu_ri(2, X_SUB, RCX, 1);
+	x86_store(2, RCPU, DRC_D(reg), RCX);
+	x86_alu_ri(2, X_CMP, RCX, 0xffff);
+	expired = x86_jcc(X86_E);
+	drc_branch(target, offset & 0x8000, cycles + (cc != 1 ? (sint)CYC_DBCC_F_NOEXP : 0), 0);
+
+	/* The displacement is only read when the branch is taken */
+	x86_patch(expired, drc_ptr);
+	drc_pref = drc_op_pc;
+	if(cc != 1)
+	{
+		x86_alu_mi(4, X_SUB, RICNT, 0, cycles + (sint)CYC_DBCC_F_EXP);
+		done = x86_jmp();
+		x86_patch(cond, drc_ptr);
+		x86_alu_mi(4, X_SUB, RICNT, 0, cycles);
+		x86_patch(done, drc_ptr);
+		drc_exit_add(x86_jcc(X86_LE), next, 0, 0);
+	}
+	else
+		drc_end(cycles);
+	return 1;
+}
+
+/* ADDQ, SUBQ, Scc, DBcc */
+static int drc_op_5(void)
+{
+	uint op = drc_op, data = (op >> 9) & 7;
+	int mode = (op >> 3) & 7, reg = op & 7, size = 1 << ((op >> 6) & 3), cc = (op >> 8) & 15;
+	int xop = (op & 0x0100) ? X_SUB : X_ADD;
+
+	if(size > 4)
+	{
+		int cycles = CYC_INSTRUCTION[op], t;
+
+		if(mode == 1)
+			return drc_dbcc();
+		if(!drc_ea_ok(mode, reg, DRC_EA_DATA_ALTER))
+			return 0;
+
+		/* Scc */
+		if(mode == 0 && cc > 1)
+		{
+			uint8* skip;
+			uint8* done;
+
+			skip = x86_jcc(drc_cond(cc) ^ 1);
+			x86_store_imm(1, RCPU, DRC_D(reg), 0xff);
+			x86_alu_mi(4, X_SUB, RICNT, 0, cycles + (sint)CYC_SCC_R_TRUE);
+			done = x86_jmp();
+			x86_patch(skip, drc_ptr);
+			x86_store_imm(1, RCPU, DRC_D(reg), 0);
+			x86_alu_mi(4, X_SUB, RICNT, 0, cycles);
+			x86_patch(done, drc_ptr);
+			drc_exit_add(x86_jcc(X86_LE), drc_pc, 0, 0);
+			return 1;
+		}
+		if(cc > 1)
+		{
+			t = drc_cond(cc);
+			x86_setcc(t, RBP);
+			x86_neg(1, RBP);
+		}
+		else
+			x86_mov_ri(RBP, cc ? 0 : 0xff);
+		drc_write_ea(1, mode, reg);
+		drc_end(cycles);
+		return 1;
+	}
+
+	if(!data)
+		data = 8;
+	if(mode == 1)
+	{
+		if(size == 1)
+			return 0;
+		x86_alu_mi(4, xop, RCPU, DRC_A(reg), data);
+	}
+	else
+	{
+		if(!drc_ea_ok(mode, reg, DRC_EA_DATA_ALTER))
+			return 0;
+		drc_rmw_read(size, mode, reg);
+		x86_alu_ri(size, xop, RCX, data);
+		drc_rmw_write(size, mode, reg, DRC_ARITH);
+	}
+	drc_end(CYC_INSTRUCTION[op]);
+	return 1;
+}
+
+/* BRA, BSR, Bcc */
+static int drc_op_6(void)
+{
+	uint op = drc_op, offset = MASK_OUT_ABOVE_8(op), target, next;
+	int cc = (op >> 8) & 15, cycles = CYC_INSTRUCTION[op], back;
+	uint8* skip;
+
+	if(offset == 0xff)
+		return 0;                             /* Bcc.l is for the 68020 */
+	if(offset == 0)
+	{
+		offset = drc_word();
+		target = drc_op_pc + 2 + MAKE_INT_16(offset);
+		back = (offset & 0x8000) != 0;
+	}
+	else
+	{
+		target = drc_op_pc + 2 + MAKE_INT_8(offset);
+		back = (offset & 0x80) != 0;
+	}
+	next = drc_pc;
+
+	if(cc == 0)
+	{
+		drc_branch(target, back, cycles, 1);
+		return 2;
+	}
+	if(cc == 1)
+	{
+		x86_mov_ri(RBP, next);
+		drc_push_32();
+		drc_branch(target, back, cycles, 0);
+		return 2;
+	}
+
+	skip = x86_jcc(drc_cond(cc) ^ 1);
+	drc_branch(target, back, cycles, 0);
+	x86_patch(skip, drc_ptr);
+
+	/* Not taken: a word displacement is skipped without reading it */
+	drc_pref = drc_op_pc;
+	drc_end(cycles + (sint)(next == drc_op_pc + 2 ? CYC_BCC_NOTAKE_B : CYC_BCC_NOTAKE_W));
+	return 1;
+}
+
+/* OR, SUB, CMP, EOR, AND, ADD and their address, multiply and exchange forms */
+static int drc_op_alu(void)
+{
+	static const int ops[16] = { 0, 0, 0, 0, 0, 0, 0, 0, X_OR, X_SUB, 0, X_CMP, X_AND, X_ADD, 0, 0 };
+	uint op = drc_op, group = op >> 12;
+	int mode = (op >> 3) & 7, reg = op & 7, rx = (op >> 9) & 7, opmode = (op >> 6) & 7;
+	int size = 1 << (opmode & 3), xop = ops[group];
+
+	if((opmode & 3) == 3)
+	{
+		if(group == 8)
+			return 0;                         /* DIVU, DIVS */
+		if(group == 0xc)
+		{
+			/* MULU, MULS */
+			if(!drc_ea_ok(mode, reg, DRC_EA_DATA))
+				return 0;
+			drc_read_ea(2, mode, reg);
+			if(opmode == 7)
+				x86_ext_rr(2, 1, RAX, RAX);
+			x86_load_ext(2, opmode == 7, RCX, RCPU, DRC_D(rx));
+			x86_imul(RCX, RAX);
+			x86_store(4, RCPU, DRC_D(rx), RCX);
+			drc_flags_logic(4);
+			drc_end(CYC_INSTRUCTION[op]);
+			return 1;
+		}
+
+		/* ADDA, SUBA, CMPA */
+		size = opmode == 3 ? 2 : 4;
+		if(!drc_ea_ok(mode, reg, DRC_EA_ALL))
+			return 0;
+		/* The handlers read An before or after (An)+/-(An) on the same
+		   register as the C compiler chose, so leave that to them */
+		if((mode == 3 || mode == 4) && reg == rx && xop != X_CMP)
+			return 0;
+		drc_read_ea(size, mode, reg);
+		if(size == 2)
+			x86_ext_rr(2, 1, RAX, RAX);
+		if(xop == X_CMP)
+		{
+			x86_load(4, RCX, RCPU, DRC_A(rx));
+			x86_alu_rr(4, X_SUB, RCX, RAX);
+			drc_flags_cv(0);
+			drc_flags_nz(4);
+		}
+		else
+			x86_alu_mr(4, xop, RCPU, DRC_A(rx), RAX);
+		drc_end(CYC_INSTRUCTION[op]);
+		return 1;
+	}
+
+	if(opmode & 4)
+	{
+		if(group == 0xb)
+		{
+			/* EOR; CMPM has mode 1 */
+			if(!drc_ea_ok(mode, reg, DRC_EA_DATA_ALTER))
+				return 0;
+			xop = X_XOR;
+		}
+		else if(mode < 2)
+		{
+			int x, y;
+
+			/* EXG; ABCD, SBCD, ADDX, SUBX are left to their handlers */
+			if((op & 0xf1f8) == 0xc140)
+				x = rx, y = reg;
+			else if((op & 0xf1f8) == 0xc148)
+				x = rx + 8, y = reg + 8;
+			else if((op & 0xf1f8) == 0xc188)
+				x = rx, y = reg + 8;
+			else
+				return 0;
+			x86_load(4, RAX, RCPU, DRC_DA(x));
+			x86_load(4, RCX, RCPU, DRC_DA(y));
+			x86_store(4, RCPU, DRC_DA(x), RCX);
+			x86_store(4, RCPU, DRC_DA(y), RAX);
+			drc_end(CYC_INSTRUCTION[op]);
+			return 1;
+		}
+		else if(!drc_ea_ok(mode, reg, DRC_EA_MEM_ALTER))
+			return 0;
+
+		/* Dn op <ea> */
+		drc_rmw_read(size, mode, reg);
+		x86_alu_rm(size, xop, RCX, RCPU, DRC_D(rx));
+		drc_rmw_write(size, mode, reg, (xop == X_ADD || xop == X_SUB) ? DRC_ARITH : xop == X_AND ? DRC_LOGIC : DRC_LOGIC_LAST);
+		drc_end(CYC_INSTRUCTION[op]);
+		return 1;
+	}
+
+	/* <ea> op Dn */
+	if(!drc_ea_ok(mode, reg, (size == 1 || xop == X_AND || xop == X_OR) ? DRC_EA_DATA : DRC_EA_ALL))
+		return 0;
+	drc_read_ea(size, mode, reg);
+	x86_load(4, RCX, RCPU, DRC_D(rx));
+	x86_alu_rr(size, xop == X_CMP ? X_SUB : xop, RCX, RAX);
+	if(xop == X_AND || xop == X_OR)
+	{
+		x86_store(size, RCPU, DRC_D(rx), RCX);
+		drc_flags_logic(size);
+	}
+	else
+	{
+		drc_flags_cv(xop != X_CMP);
+		drc_flags_nz(size);
+		if(xop != X_CMP)
+			x86_store(size, RCPU, DRC_D(rx), RCX);
+	}
+	drc_end(CYC_INSTRUCTION[op]);
+	return 1;
+}
+
+/* ASR, LSL, LSR, ROL, ROR by an immediate count on a data register */
+static int drc_op_e(void)
+{
+	uint op = drc_op;
+	int reg = op & 7, size = 1 << ((op >> 6) & 3), type = (op >> 3) & 3, left = (op & 0x0100) != 0;
+	int count = (op >> 9) & 7, xop;
+
+	if(!count)
+		count = 8;
+	if(size > 4 || (op & 0x20) || type == 2 || (type == 0 && left))
+		return 0;
+	if(size == 1 && count == 8)
+		return 0;                             /* The host leaves the carry undefined */
+
+	xop = type == 0 ? X_SAR : type == 1 ? (left ? X_SHL : X_SHR) : (left ? X_ROL : X_ROR);
+	x86_load(4, RCX, RCPU, DRC_D(reg));
+	x86_shift_ri(size, xop, RCX, count);
+	x86_setcc(X86_B, RAX);
+	x86_ext_rr(1, 0, RAX, RAX);
+	x86_shift_ri(4, X_SHL, RAX, 8);
+	x86_store(4, RCPU, DRC_OFS(c_flag), RAX);
+	if(type != 3)
+		x86_store(4, RCPU, DRC_OFS(x_flag), RAX);
+	x86_store(size, RCPU, DRC_D(reg), RCX);
+	drc_flags_nz(size);
+	x86_store_imm(4, RCPU, DRC_OFS(v_flag), 0);
+	drc_end(CYC_INSTRUCTION[op] + (count << CYC_SHIFT));
+	return 1;
+}
+
+static int drc_native(void)
+{
+	uint op = drc_op;
+
+	if(m68ki_instruction_jump_table[op] == m68k_op_illegal)
+		return 0;
+
+	switch(op >> 12)
+	{
+		case 0x0:
+			return drc_op_0();
+		case 0x1: case 0x2: case 0x3:
+			return drc_move();
+		case 0x4:
+			return drc_op_4();
+		case 0x5:
+			return drc_op_5();
+		case 0x6:
+			return drc_op_6();
+		case 0x7:
+			if(op & 0x0100)
+				return 0;
+			x86_store_imm(4, RCPU, DRC_D((op >> 9) & 7), MAKE_INT_8(op));
+			x86_store_imm(4, RCPU, DRC_OFS(n_flag), (op & 0x80) ? 0xff : 0);
+			x86_store_imm(4, RCPU, DRC_OFS(not_z_flag), MAKE_INT_8(op));
+			x86_store_imm(4, RCPU, DRC_OFS(v_flag), 0);
+			x86_store_imm(4, RCPU, DRC_OFS(c_flag), 0);
+			drc_end(CYC_INSTRUCTION[op]);
+			return 1;
+		case 0x8: case 0x9: case 0xb: case 0xc: case 0xd:
+			return drc_op_alu();
+		case 0xe:
+			return drc_op_e();
+	}
+	return 0;
+}
+
+/* Words in an addressing mode's extension */
+static int drc_ea_words(int mode, int reg, int size)
+{
+	if(mode == 5 || mode == 6)
+		return 1;
+	if(mode != 7)
+		return 0;
+	switch(reg)
+	{
+		case 0: case 2: case 3:
+			return 1;
+		case 1:
+			return 2;
+		case 4:
+			return size == 4 ? 2 : 1;
+	}
+	return 0;
+}
+
+/* Length in words of an instruction which doesn't branch, 0 if not known */
+static int drc_length(uint op)
+{
+	int mode = (op >> 3) & 7, reg = op & 7, code = (op >> 6) & 3, opmode = (op >> 6) & 7;
+	int size = code == 0 ? 1 : code == 1 ? 2 : 4, group = op >> 12;
+
+	switch(group)
+	{
+		case 0x0:
+			if(op & 0x0100)
+				return mode == 1 ? 2 : 1 + drc_ea_words(mode, reg, 1);
+			if((op & 0x0f00) == 0x0800)
+				return 2 + drc_ea_words(mode, reg, 1);
+			if((op & 0x003f) == 0x003c)
+				return 2;
+			return code == 3 ? 0 : 1 + (size == 4 ? 2 : 1) + drc_ea_words(mode, reg, size);
+		case 0x1: case 0x2: case 0x3:
+			size = group == 1 ? 1 : group == 3 ? 2 : 4;
+			return 1 + drc_ea_words(mode, reg, size) + drc_ea_words(opmode, (op >> 9) & 7, size);
+		case 0x4:
+			if((op & 0xfff0) == 0x4e70)
+				return (op == 0x4e70 || op == 0x4e71 || op == 0x4e76) ? 1 : op == 0x4e72 ? 2 : 0;
+			if((op & 0xffc0) == 0x4e80 || (op & 0xffc0) == 0x4ec0)
+				return 0;
+			if((op & 0xfff8) == 0x4e50)
+				return 2;
+			if((op & 0xffc0) == 0x4e40)
+				return 1;
+			if((op & 0xfb80) == 0x4880 && mode >= 2)
+				return 2 + drc_ea_words(mode, reg, 2);
+			return 1 + drc_ea_words(mode, reg, code == 3 ? 2 : size);
+		case 0x5:
+			return (code == 3 && mode == 1) ? 0 : 1 + drc_ea_words(mode, reg, 1);
+		case 0x7:
+			return 1;
+		case 0x8: case 0x9: case 0xb: case 0xc: case 0xd:
+			if((opmode & 3) == 3)
+				size = (opmode == 7 && (group == 0x9 || group == 0xb || group == 0xd)) ? 4 : 2;
+			else if((opmode & 4) && mode < 2 && group != 0xb)
+				return 1;
+			return 1 + drc_ea_words(mode, reg, size);
+		case 0xe:
+			return 1 + (code == 3 ? drc_ea_words(mode, reg, 2) : 0);
+	}
+	return 0;
+}
+
+/* Anything else calls its handler */
+static int drc_fallback(void)
+{
+	uint op = drc_op, pref = MASK_OUT_BELOW_2(drc_op_pc);
+	int length = drc_length(op), i;
+
+	x86_store_imm(4, RCPU, DRC_OFS(ppc), drc_op_pc);
+	x86_store_imm(4, RCPU, DRC_OFS(pc), drc_op_pc + 2);
+	x86_store_imm(4, RCPU, DRC_OFS(ir), op);
+	x86_store_imm(4, RCPU, DRC_OFS(pref_addr), pref);
+	x86_store_imm(4, RCPU, DRC_OFS(pref_data), m68k_read_immediate_32(ADDRESS_68K(pref)));
+	x86_call(m68ki_instruction_jump_table[op]);
+	x86_alu_mi(4, X_SUB, RICNT, 0, CYC_INSTRUCTION[op]);
+	x86_jcc_to(X86_LE, drc_exit);
+	x86_alu_mi(1, X_CMP, RBRK, 0, 0);
+	x86_jcc_to(X86_NE, drc_exit);
+	if(!length)
+	{
+		x86_jmp_to(drc_dispatch);
+		return 2;
+	}
+
+	/* Carry on if the handler didn't change the flow */
+	for(i = 1; i < length; i++)
+		drc_word();
+	x86_alu_mi(4, X_CMP, RCPU, DRC_OFS(pc), drc_pc);
+	x86_jcc_to(X86_NE, drc_dispatch);
+	return 1;
+}
+
+
+/* ======================================================================== */
+/* ============================== TRANSLATOR ============================== */
+/* ======================================================================== */
+
+static void* drc_translate(uint pc)
+{
+	void** slot;
+	uint8* start;
+	int n, result = 1;
+
+	if(drc_ptr > drc_code + DRC_CODE_SIZE - DRC_CODE_SPARE)
+		m68k_drc_flush();
+	slot = drc_slot(pc);
+	if(!slot)
+		return NULL;
+
+	start = drc_ptr;
+	drc_exit_count = 0;
+	drc_slow_count = 0;
+	drc_pc = pc;
+	drc_pref = pc;
+
+	for(n = 0; n < DRC_BLOCK_INSNS && result != 2; n++)
+	{
+		uint8* ptr = drc_ptr;
+		int exits = drc_exit_count, slows = drc_slow_count;
+		uint at = drc_pc, pref = drc_pref;
+
+		if(drc_exit_count > DRC_MAX_EXITS - 32 || drc_slow_count > DRC_MAX_SLOW - 32 || drc_ptr - start > DRC_BLOCK_CODE)
+			break;
+
+		drc_op_pc = drc_pc;
+		drc_abort = 0;
+		drc_callouts = 0;
+		drc_op = drc_word();
+		if(drc_abort)
+			break;
+
+		result = drc_native();
+		if(!result && !drc_abort)
+		{
+			drc_ptr = ptr;
+			drc_exit_count = exits;
+			drc_slow_count = slows;
+			drc_pc = drc_op_pc + 2;
+			drc_pref = drc_op_pc;
+			drc_callouts = 0;
+			result = drc_fallback();
+		}
+		if(drc_abort)
+		{
+			/* Leave the instruction for the next block */
+			drc_ptr = ptr;
+			drc_exit_count = exits;
+			drc_slow_count = slows;
+			drc_pc = at;
+			drc_pref = pref;
+			result = 1;
+			break;
+		}
+	}
+
+	if(drc_ptr == start)
+		return NULL;
+	if(result != 2)
+		drc_link(drc_pc);
+	drc_emit_exits();
+	drc_emit_slows();
+
+	drc_page_used[pc >> DRC_PAGE_BITS] = 1;
+	*slot = start;
+	return start;
+}
+
+
+/* ======================================================================== */
+/* ============================== EXECUTION =============================== */
+/* ======================================================================== */
+
+/* Execute some instructions until we use up num_cycles clock cycles, as m68k_execute() */
+int m68k_drc_execute(int num_cycles)
+{
+#if M68K_INSTRUCTION_HOOK || M68K_EMULATE_TRACE || M68K_EMULATE_ADDRESS_ERROR || M68K_EMULATE_FC || M68K_MONITOR_PC
+	return m68k_execute(num_cycles);
+#else
+	if(!CPU_TYPE_IS_000(CPU_TYPE) || drc_failed || (!drc_code && !drc_init()))
+		return m68k_execute(num_cycles);
+
+	if(CPU_STOPPED)
+	{
+		SET_CYCLES(0);
+		CPU_INT_CYCLES = 0;
+		return num_cycles;
+	}
+
+	SET_CYCLES(num_cycles);
+	m68ki_initial_cycles = num_cycles;
+	USE_CYCLES(CPU_INT_CYCLES);
+	CPU_INT_CYCLES = 0;
+
+	do
+	{
+		void* block = NULL;
+
+		/* Code in RAM is run by the handlers without looking each time */
+		if((REG_PC >> DRC_PAGE_BITS) != drc_skip_page)
+		{
+			block = drc_lookup(REG_PC);
+			if(!block)
+				block = drc_translate(REG_PC);
+		}
+		if(block)
+		{
+			drc_break = 0;
+			drc_enter(block);
+		}
+		else
+		{
+			REG_PPC = REG_PC;
+			REG_IR = m68ki_read_imm_16();
+			m68ki_instruction_jump_table[REG_IR]();
+			USE_CYCLES(CYC_INSTRUCTION[REG_IR]);
+		}
+	} while(GET_CYCLES() > 0);
+
+	REG_PPC = REG_PC;
+	USE_CYCLES(CPU_INT_CYCLES);
+	CPU_INT_CYCLES = 0;
+
+	return m68ki_initial_cycles - GET_CYCLES();
+#endif
+}
+
+#endif /* EMU_M68K_DRC */
+
+/* ======================================================================== */
+/* ============================== END OF FILE ============================= */
+/* ======================================================================== */
@@ -443,6 +443,49 @@ Z80_INLINE void BURNODD(int cycles, int opcodes, int cyclesum)
 	}
 }
 
+/****************************************************************************/
+/* Idle loop skipping. Everything a Z80 can see from outside (writes, I/O,  */
+/* reads going to handlers, LD A,R) counts in nZ80IdleBreak. If a backward  */
+/* jump finds the CPU in the same state as at the previous one, in the same */
+/* Z80Execute() and with nothing seen from outside since, the CPU will go   */
+/* round the same way until an interrupt, so the passes left in the slice   */
+/* are burnt in one go. Only for machines where nothing else changes the    */
+/* Z80's RAM while it runs.                                                 */
+/****************************************************************************/
+INT32 nZ80IdleSkip = 0;
+UINT32 nZ80IdleBreak = 0;
+
+static UINT32 nZ80IdleSlice = 0;				/* Counts Z80Execute() calls */
+static UINT32 nZ80IdleSliceLast;
+static UINT32 nZ80IdleBreakLast;
+static int nZ80IdleICount;						/* z80_ICount at the last backward jump */
+static UINT8 nZ80IdleR;
+static UINT32 nZ80IdleEA;
+static Z80_PAIR Z80IdlePairs[13];				/* prvpc to hl2 */
+static UINT8 Z80IdleFlags[10];					/* r2 to after_ei, R is left out as it counts fetches */
+
+static void Z80IdleLoop(void)
+{
+	if( nZ80IdleSliceLast == nZ80IdleSlice && nZ80IdleBreakLast == nZ80IdleBreak && nZ80IdleEA == EA &&
+		memcmp(Z80IdlePairs, &Z80.prvpc, sizeof(Z80IdlePairs)) == 0 &&
+		memcmp(Z80IdleFlags, &Z80.r2, sizeof(Z80IdleFlags)) == 0 )
+	{
+		/* Go round as many times as will still end with cycles left, as running them would */
+		if( Z80.irq_state == Z80_CLEAR_LINE && nZ80IdleICount > z80_ICount )
+			BURNODD( z80_ICount - 1, (UINT8)(R - nZ80IdleR), nZ80IdleICount - z80_ICount );
+	}
+
+	nZ80IdleSliceLast = nZ80IdleSlice;
+	nZ80IdleBreakLast = nZ80IdleBreak;
+	nZ80IdleICount = z80_ICount;
+	nZ80IdleR = R;
+	nZ80IdleEA = EA;
+	memcpy(Z80IdlePairs, &Z80.prvpc, sizeof(Z80IdlePairs));
+	memcpy(Z80IdleFlags, &Z80.r2, sizeof(Z80IdleFlags));
+}
+
+#define IDLE_LOOP if( nZ80IdleSkip && PCD < PRVPC ) Z80IdleLoop()
+
 /***************************************************************
  * define an opcode function
  ***************************************************************/
@@ -565,12 +608,12 @@ Z80_INLINE void BURNODD(int cycles, int opcodes, int cyclesum)
 /***************************************************************
  * Input a byte from given I/O port
  ***************************************************************/
-#define IN(port)   ((UINT8)Z80IORead(port))
+#define IN(port)   ((UINT8)(nZ80IdleBreak++, Z80IORead(port)))
 
 /***************************************************************
  * Output a byte to given I/O port
  ***************************************************************/
-#define OUT(port,value) Z80IOWrite(port,value)
+#define OUT(port,value) (nZ80IdleBreak++, Z80IOWrite(port,value))
 
 /***************************************************************
  * Read a byte from given memory location
@@ -589,7 +632,7 @@ Z80_INLINE void RM16( UINT32 addr, Z80_PAIR *r )
 /***************************************************************
  * Write a byte to given memory location
  ***************************************************************/
-#define WM(addr,value) Z80ProgramWrite(addr,value)
+#define WM(addr,value) (nZ80IdleBreak++, Z80ProgramWrite(addr,value))
 
 #define cpu_readop(n) Z80CPUReadOp(n)
 #define cpu_readop_arg(n) Z80CPUReadOpArg(n)
@@ -688,11 +731,13 @@ Z80_INLINE UINT32 ARG16(void)
 					2, cc[Z80_TABLE_op][0x31]+cc[Z80_TABLE_op][0xc3]); \
 		}														\
 	}															\
+	IDLE_LOOP;													\
 }
 #else
 #define JP {													\
 	PCD = ARG16();												\
 	change_pc(PCD);												\
+	IDLE_LOOP;													\
 }
 #endif
 
@@ -705,6 +750,7 @@ Z80_INLINE UINT32 ARG16(void)
 	{															\
 		PCD = ARG16();											\
 		change_pc(PCD);											\
+		IDLE_LOOP;												\
 	}															\
 	else														\
 	{															\
@@ -748,6 +794,7 @@ Z80_INLINE UINT32 ARG16(void)
 				   2, cc[Z80_TABLE_op][0x31]+cc[Z80_TABLE_op][0x18]); \
 		}														\
 	}															\
+	IDLE_LOOP;													\
 }
 
 /***************************************************************
@@ -760,6 +807,7 @@ Z80_INLINE UINT32 ARG16(void)
 		PC += arg;				/* so don't do PC += ARG() */	\
 		CC(ex,opcode);											\
 		change_pc(PCD);											\
+		IDLE_LOOP;												\
 	}															\
 	else PC++;													\
 
@@ -834,6 +882,7 @@ Z80_INLINE UINT32 ARG16(void)
  * LD   A,R
  ***************************************************************/
 #define LD_A_R {												\
+	nZ80IdleBreak++;											\
 	A = (R & 0x7f) | R2;										\
 	F = (F & CF) | SZ[A] | ( IFF2 << 2 );						\
 }
@@ -3507,6 +3556,7 @@ int Z80Execute(int cycles)
 {
 	z80_ICount = cycles;
 	Z80.cycles_left = cycles;
+	nZ80IdleSlice++;
 
 	/* check for NMIs on the way in; they can only be set externally */
 	/* via timers, and can't be dynamically enabled, so it is safe */
@@ -71,6 +71,8 @@ extern unsigned char Z80Vector;
 
 extern int z80_ICount;
 extern UINT32 EA;
+extern INT32 nZ80IdleSkip;
+extern UINT32 nZ80IdleBreak;
 
 typedef unsigned char (__fastcall *Z80ReadIoHandler)(unsigned int a);
 typedef void (__fastcall *Z80WriteIoHandler)(unsigned int a, unsigned char v);
@@ -57,6 +57,7 @@ UINT8 __fastcall ZetReadProg(UINT32 a)
 	
 	// check handler
 	if (ZetCPUContext[nOpenedCPU]->ZetRead != NULL) {
+		nZ80IdleBreak++;
 		return ZetCPUContext[nOpenedCPU]->ZetRead(a);
 	}
 	
@@ -89,6 +90,7 @@ UINT8 __fastcall ZetReadOp(UINT32 a)
 	
 	// check read handler
 	if (ZetCPUContext[nOpenedCPU]->ZetRead != NULL) {
+		nZ80IdleBreak++;
 		return ZetCPUContext[nOpenedCPU]->ZetRead(a);
 	}
 	
@@ -105,6 +107,7 @@ UINT8 __fastcall ZetReadOpArg(UINT32 a)
 	
 	// check read handler
 	if (ZetCPUContext[nOpenedCPU]->ZetRead != NULL) {
+		nZ80IdleBreak++;
 		return ZetCPUContext[nOpenedCPU]->ZetRead(a);
 	}
 	
@@ -327,6 +330,14 @@ void ZetExit(void)
 
 	nCPUCount = 0;
 	nHasZet = -1;
+	nZ80IdleSkip = 0;
+}
+
+// Skip the rest of the timeslice when the Z80 goes round a loop which can't
+// end before an interrupt (see Z80IdleLoop in z80/z80.c)
+void ZetSetIdleSkip(INT32 bEnable)
+{
+	nZ80IdleSkip = bEnable;
 }
 
 
@@ -66,6 +66,10 @@ void ZetSetOutHandler(void (__fastcall *pHandler)(UINT16, UINT8));
 
 void ZetSetBUSREQLine(INT32 nStatus);
 
+// Skip the rest of the timeslice in idle loops.
+// Only for machines where RAM is changed by nothing but the Z80 during a timeslice
+void ZetSetIdleSkip(INT32 bEnable);
+
 #ifdef __cplusplus
 }
 #endif
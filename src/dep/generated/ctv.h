@@ -1,1652 +1,617 @@
-static INT32 CtvDo208____()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-   ctp = CpstPal;
-
-   for (y = 0; y < (8); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd)
-   {
-      pPix = pCtvLine;
-      b=*((UINT32 *)(pCtvTile+0)); nBlank |= b; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4;
-   }
-
-   return nBlank == 0;
-}
-
-
-static INT32 CtvDo208__f_()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (8); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-       )
-   {
-      pPix = pCtvLine;
-      b=*((UINT32 *)(pCtvTile+0)); nBlank |= b; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4;
-   }
-
-   return nBlank == 0;
-}
-
-static INT32 CtvDo208_c__()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (8); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-       )
-   {
-
-      UINT32 rx = nCtvRollX;
-
-
-
-
-
-
-
-      if (nCtvRollY & 0x20004000) { nCtvRollY += 0x7fff; continue; } else nCtvRollY += 0x7fff;
-
-
-
-      pPix = pCtvLine;
-      b=*((UINT32 *)(pCtvTile+0)); nBlank |= b; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff;
-   }
-
-   return nBlank == 0;
-}
-
-
-static INT32 CtvDo208_cf_()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (8); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-       )
-   {
-
-      UINT32 rx = nCtvRollX;
-
-
-
-
-
-
-
-      if (nCtvRollY & 0x20004000) { nCtvRollY += 0x7fff; continue; } else nCtvRollY += 0x7fff;
-
-
-
-      pPix = pCtvLine;
-      b=*((UINT32 *)(pCtvTile+0)); nBlank |= b; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff;
-   }
-
-   return nBlank == 0;
-}
-static INT32 CtvDo216____()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (16); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-       )
-   {
-      pPix = pCtvLine;
-      b=*((UINT32 *)(pCtvTile+0)); nBlank |= b; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4;
-      b=*((UINT32 *)(pCtvTile+4)); nBlank |= b; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4;
-   }
-
-   return nBlank == 0;
-}
-
-
-static INT32 CtvDo216__f_()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (16); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-       )
-   {
-      pPix = pCtvLine;
-      b=*((UINT32 *)(pCtvTile+4)); nBlank |= b; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4;
-      b=*((UINT32 *)(pCtvTile+0)); nBlank |= b; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4;
-   }
-
-   return nBlank == 0;
-}
-
-
-static INT32 CtvDo216_c__()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (16); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-       )
-   {
-
-      UINT32 rx = nCtvRollX;
-
-
-
-
-
-
-
-      if (nCtvRollY & 0x20004000) { nCtvRollY += 0x7fff; continue; } else nCtvRollY += 0x7fff;
-
-
-
-      pPix = pCtvLine;
-      b=*((UINT32 *)(pCtvTile+0)); nBlank |= b; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff;
-      b=*((UINT32 *)(pCtvTile+4)); nBlank |= b; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff;
-   }
-
-   return nBlank == 0;
-}
-
-
-static INT32 CtvDo216_cf_()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (16); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-       )
-   {
-
-      UINT32 rx = nCtvRollX;
-
-
-
-
-
-
-
-      if (nCtvRollY & 0x20004000) { nCtvRollY += 0x7fff; continue; } else nCtvRollY += 0x7fff;
-
-
-
-      pPix = pCtvLine;
-      b=*((UINT32 *)(pCtvTile+4)); nBlank |= b; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff;
-      b=*((UINT32 *)(pCtvTile+0)); nBlank |= b; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff;
-   }
-
-   return nBlank == 0;
-}
-static INT32 CtvDo216r___()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-   INT16 *Rows = CpstRowShift;
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (16); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-
-
-         ,Rows++
-
-
-
-
-
-
-       )
-   {
-      pPix = pCtvLine;
-      pPix += Rows[0] * nBurnBpp;
-      b=*((UINT32 *)(pCtvTile+0)); nBlank |= b; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4;
-      b=*((UINT32 *)(pCtvTile+4)); nBlank |= b; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4;
-   }
-
-   return nBlank == 0;
-}
-
-
-static INT32 CtvDo216r_f_()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-   INT16 *Rows = CpstRowShift;
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (16); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-
-
-         ,Rows++
-
-
-
-
-
-
-       )
-   {
-      pPix = pCtvLine;
-      pPix += Rows[0] * nBurnBpp;
-      b=*((UINT32 *)(pCtvTile+4)); nBlank |= b; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4;
-      b=*((UINT32 *)(pCtvTile+0)); nBlank |= b; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4;
-   }
-
-   return nBlank == 0;
-}
-
-
-
-
-
-static INT32 CtvDo216rc__()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-   INT16 *Rows = CpstRowShift;
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (16); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-
-
-         ,Rows++
-
-
-
-
-
-
-       )
-   {
-
-      UINT32 rx = nCtvRollX;
-
-
-
-
-
-
-
-      if (nCtvRollY & 0x20004000) { nCtvRollY += 0x7fff; continue; } else nCtvRollY += 0x7fff;
-
-
-
-      pPix = pCtvLine;
-      pPix += Rows[0] * nBurnBpp;
-
-      rx += Rows[0] * 0x7fff;
-      b=*((UINT32 *)(pCtvTile+0)); nBlank |= b; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff;
-      b=*((UINT32 *)(pCtvTile+4)); nBlank |= b; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff;
-   }
-
-   return nBlank == 0;
-}
-
-
-static INT32 CtvDo216rcf_()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-   INT16 *Rows = CpstRowShift;
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (16); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-
-
-         ,Rows++
-
-
-
-
-
-
-       )
-   {
-
-      UINT32 rx = nCtvRollX;
-
-
-
-
-
-
-
-      if (nCtvRollY & 0x20004000) { nCtvRollY += 0x7fff; continue; } else nCtvRollY += 0x7fff;
-
-
-
-      pPix = pCtvLine;
-      pPix += Rows[0] * nBurnBpp;
-
-      rx += Rows[0] * 0x7fff;
-      b=*((UINT32 *)(pCtvTile+4)); nBlank |= b; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff;
-      b=*((UINT32 *)(pCtvTile+0)); nBlank |= b; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff;
-   }
-
-   return nBlank == 0;
-}
-static INT32 CtvDo232____()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (32); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-       )
-   {
-      pPix = pCtvLine;
-      b=*((UINT32 *)(pCtvTile+ 0)); nBlank |= b; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4;
-      b=*((UINT32 *)(pCtvTile+ 4)); nBlank |= b; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4;
-      b=*((UINT32 *)(pCtvTile+ 8)); nBlank |= b; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4;
-      b=*((UINT32 *)(pCtvTile+12)); nBlank |= b; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4;
-   }
-
-   return nBlank == 0;
-}
-
-
-static INT32 CtvDo232__f_()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (32); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-       )
-   {
-      pPix = pCtvLine;
-      b=*((UINT32 *)(pCtvTile+12)); nBlank |= b; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4;
-      b=*((UINT32 *)(pCtvTile+ 8)); nBlank |= b; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4;
-      b=*((UINT32 *)(pCtvTile+ 4)); nBlank |= b; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4;
-      b=*((UINT32 *)(pCtvTile+ 0)); nBlank |= b; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4;
-   }
-
-   return nBlank == 0;
-}
-
-
-
-
-
-static INT32 CtvDo232_c__()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (32); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-       )
-   {
-
-      UINT32 rx = nCtvRollX;
-
-
-
-
-
-
-
-      if (nCtvRollY & 0x20004000) { nCtvRollY += 0x7fff; continue; } else nCtvRollY += 0x7fff;
-
-
-
-      pPix = pCtvLine;
-      b=*((UINT32 *)(pCtvTile+ 0)); nBlank |= b; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff;
-      b=*((UINT32 *)(pCtvTile+ 4)); nBlank |= b; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff;
-      b=*((UINT32 *)(pCtvTile+ 8)); nBlank |= b; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff;
-      b=*((UINT32 *)(pCtvTile+12)); nBlank |= b; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff;
-   }
-
-   return nBlank == 0;
-}
-
-
-static INT32 CtvDo232_cf_()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (32); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-       )
-   {
-
-      UINT32 rx = nCtvRollX;
-
-
-
-
-
-
-
-      if (nCtvRollY & 0x20004000) { nCtvRollY += 0x7fff; continue; } else nCtvRollY += 0x7fff;
-
-
-
-      pPix = pCtvLine;
-      b=*((UINT32 *)(pCtvTile+12)); nBlank |= b; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff;
-      b=*((UINT32 *)(pCtvTile+ 8)); nBlank |= b; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff;
-      b=*((UINT32 *)(pCtvTile+ 4)); nBlank |= b; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff;
-      b=*((UINT32 *)(pCtvTile+ 0)); nBlank |= b; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff;
-   }
-
-   return nBlank == 0;
-}
-static INT32 CtvDo208___m()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (8); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-
-
-
-
-
-
-         ,pZVal += 384
-
-
-       )
-   {
-
-
-
-
-
-      UINT16 *pPixZ;
-
-
-
-
-
-
-
-      pPix = pCtvLine;
-
-      pPixZ = pZVal;
-      b=*((UINT32 *)(pCtvTile+0)); nBlank |= b; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4;
-   }
-
-   return nBlank == 0;
-}
-
-
-static INT32 CtvDo208__fm()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (8); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-
-
-
-
-
-
-         ,pZVal += 384
-
-
-       )
-   {
-
-
-
-
-
-      UINT16 *pPixZ;
-
-
-
-
-
-
-
-      pPix = pCtvLine;
-
-      pPixZ = pZVal;
-      b=*((UINT32 *)(pCtvTile+0)); nBlank |= b; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4;
-   }
-
-   return nBlank == 0;
-}
-
-
-
-
-
-static INT32 CtvDo208_c_m()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (8); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-
-
-
-
-
-
-         ,pZVal += 384
-
-
-       )
-   {
-
-      UINT32 rx = nCtvRollX;
-
-
-
-      UINT16 *pPixZ;
-
-
-
-      if (nCtvRollY & 0x20004000) { nCtvRollY += 0x7fff; continue; } else nCtvRollY += 0x7fff;
-
-
-
-      pPix = pCtvLine;
-
-      pPixZ = pZVal;
-      b=*((UINT32 *)(pCtvTile+0)); nBlank |= b; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff;
-   }
-
-   return nBlank == 0;
-}
-
-
-static INT32 CtvDo208_cfm()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (8); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-
-
-
-
-
-
-         ,pZVal += 384
-
-
-       )
-   {
-
-      UINT32 rx = nCtvRollX;
-
-
-
-      UINT16 *pPixZ;
-
-
-
-      if (nCtvRollY & 0x20004000) { nCtvRollY += 0x7fff; continue; } else nCtvRollY += 0x7fff;
-
-
-
-      pPix = pCtvLine;
-
-      pPixZ = pZVal;
-      b=*((UINT32 *)(pCtvTile+0)); nBlank |= b; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff;
-   }
-
-   return nBlank == 0;
-}
-static INT32 CtvDo216___m()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (16); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-
-
-
-
-
-
-         ,pZVal += 384
-
-
-       )
-   {
-
-
-
-
-
-      UINT16 *pPixZ;
-
-
-
-
-
-
-
-      pPix = pCtvLine;
-
-      pPixZ = pZVal;
-      b=*((UINT32 *)(pCtvTile+0)); nBlank |= b; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4;
-      b=*((UINT32 *)(pCtvTile+4)); nBlank |= b; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4;
-   }
-
-   return nBlank == 0;
-}
-
-
-static INT32 CtvDo216__fm()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (16); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-
-
-
-
-
-
-         ,pZVal += 384
-
-
-       )
-   {
-
-
-
-
-
-      UINT16 *pPixZ;
-
-
-
-
-
-
-
-      pPix = pCtvLine;
-
-      pPixZ = pZVal;
-      b=*((UINT32 *)(pCtvTile+4)); nBlank |= b; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4;
-      b=*((UINT32 *)(pCtvTile+0)); nBlank |= b; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4;
-   }
-
-   return nBlank == 0;
-}
-
-
-
-
-
-static INT32 CtvDo216_c_m()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (16); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-
-
-
-
-
-
-         ,pZVal += 384
-
-
-       )
-   {
-
-      UINT32 rx = nCtvRollX;
-
-
-
-      UINT16 *pPixZ;
-
-
-
-      if (nCtvRollY & 0x20004000) { nCtvRollY += 0x7fff; continue; } else nCtvRollY += 0x7fff;
-
-
-
-      pPix = pCtvLine;
-
-      pPixZ = pZVal;
-      b=*((UINT32 *)(pCtvTile+0)); nBlank |= b; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff;
-      b=*((UINT32 *)(pCtvTile+4)); nBlank |= b; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff;
-   }
-
-   return nBlank == 0;
-}
-
-
-static INT32 CtvDo216_cfm()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (16); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-
-
-
-
-
-
-         ,pZVal += 384
-
-
-       )
-   {
-
-      UINT32 rx = nCtvRollX;
-
-
-
-      UINT16 *pPixZ;
-
-
-
-      if (nCtvRollY & 0x20004000) { nCtvRollY += 0x7fff; continue; } else nCtvRollY += 0x7fff;
-
-
-
-      pPix = pCtvLine;
-
-      pPixZ = pZVal;
-      b=*((UINT32 *)(pCtvTile+4)); nBlank |= b; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff;
-      b=*((UINT32 *)(pCtvTile+0)); nBlank |= b; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff;
-   }
-
-   return nBlank == 0;
-}
-static INT32 CtvDo232___m()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (32); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-
-
-
-
-
-
-         ,pZVal += 384
-
-
-       )
-   {
-
-
-
-
-
-      UINT16 *pPixZ;
-
-
-
-
-
-
-
-      pPix = pCtvLine;
-
-      pPixZ = pZVal;
-      b=*((UINT32 *)(pCtvTile+ 0)); nBlank |= b; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4;
-      b=*((UINT32 *)(pCtvTile+ 4)); nBlank |= b; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4;
-      b=*((UINT32 *)(pCtvTile+ 8)); nBlank |= b; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4;
-      b=*((UINT32 *)(pCtvTile+12)); nBlank |= b; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4;
-   }
-
-   return nBlank == 0;
-}
-
-
-static INT32 CtvDo232__fm()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (32); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-
-
-
-
-
-
-         ,pZVal += 384
-
-
-       )
-   {
-
-
-
-
-
-      UINT16 *pPixZ;
-
-
-
-
-
-
-
-      pPix = pCtvLine;
-
-      pPixZ = pZVal;
-      b=*((UINT32 *)(pCtvTile+12)); nBlank |= b; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4;
-      b=*((UINT32 *)(pCtvTile+ 8)); nBlank |= b; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4;
-      b=*((UINT32 *)(pCtvTile+ 4)); nBlank |= b; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4;
-      b=*((UINT32 *)(pCtvTile+ 0)); nBlank |= b; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4;
-   }
-
-   return nBlank == 0;
-}
-
-
-
-
-
-static INT32 CtvDo232_c_m()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (32); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-
-
-
-
-
-
-         ,pZVal += 384
-
-
-       )
-   {
-
-      UINT32 rx = nCtvRollX;
-
-
-
-      UINT16 *pPixZ;
-
-
-
-      if (nCtvRollY & 0x20004000) { nCtvRollY += 0x7fff; continue; } else nCtvRollY += 0x7fff;
-
-
-
-      pPix = pCtvLine;
-
-      pPixZ = pZVal;
-      b=*((UINT32 *)(pCtvTile+ 0)); nBlank |= b; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff;
-      b=*((UINT32 *)(pCtvTile+ 4)); nBlank |= b; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff;
-      b=*((UINT32 *)(pCtvTile+ 8)); nBlank |= b; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff;
-      b=*((UINT32 *)(pCtvTile+12)); nBlank |= b; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0xf0000000) { c = ctp[b >> 28]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b <<= 4; rx += 0x7fff;
-   }
-
-   return nBlank == 0;
-}
-
-
-static INT32 CtvDo232_cfm()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (32); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-
-
-
-
-
-
-         ,pZVal += 384
-
-
-       )
-   {
-
-      UINT32 rx = nCtvRollX;
-
-
-
-      UINT16 *pPixZ;
-
-
-
-      if (nCtvRollY & 0x20004000) { nCtvRollY += 0x7fff; continue; } else nCtvRollY += 0x7fff;
-
-
-
-      pPix = pCtvLine;
-
-      pPixZ = pZVal;
-      b=*((UINT32 *)(pCtvTile+12)); nBlank |= b; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff;
-      b=*((UINT32 *)(pCtvTile+ 8)); nBlank |= b; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff;
-      b=*((UINT32 *)(pCtvTile+ 4)); nBlank |= b; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff;
-      b=*((UINT32 *)(pCtvTile+ 0)); nBlank |= b; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { if (b & 0x0000000f) { c = ctp[b & 15]; { if(*pPixZ < ZValue) { *((UINT16 *)pPix)=(UINT16)c; *pPixZ=ZValue; } } } } { pPix+=2; pPixZ++; }; b >>= 4; rx += 0x7fff;
-   }
-
-   return nBlank == 0;
-}
-static INT32 CtvDo208___b()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (8); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-       )
-   {
-      pPix = pCtvLine;
-      b=*((UINT32 *)(pCtvTile+0)); nBlank |= b; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4;
-   }
-
-   return nBlank == 0;
-}
-
-
-static INT32 CtvDo208__fb()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (8); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-       )
-   {
-      pPix = pCtvLine;
-      b=*((UINT32 *)(pCtvTile+0)); nBlank |= b; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4;
-   }
-
-   return nBlank == 0;
-}
-
-
-
-
-
-static INT32 CtvDo208_c_b()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (8); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-       )
-   {
-
-      UINT32 rx = nCtvRollX;
-
-
-
-
-
-
-
-      if (nCtvRollY & 0x20004000) { nCtvRollY += 0x7fff; continue; } else nCtvRollY += 0x7fff;
-
-
-
-      pPix = pCtvLine;
-      b=*((UINT32 *)(pCtvTile+0)); nBlank |= b; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff;
-   }
-
-   return nBlank == 0;
-}
-
-
-static INT32 CtvDo208_cfb()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (8); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-       )
-   {
-
-      UINT32 rx = nCtvRollX;
-
-
-
-
-
-
-
-      if (nCtvRollY & 0x20004000) { nCtvRollY += 0x7fff; continue; } else nCtvRollY += 0x7fff;
-
-
-
-      pPix = pCtvLine;
-      b=*((UINT32 *)(pCtvTile+0)); nBlank |= b; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff;
-   }
-
-   return nBlank == 0;
-}
-static INT32 CtvDo216___b()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (16); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-       )
-   {
-      pPix = pCtvLine;
-      b=*((UINT32 *)(pCtvTile+0)); nBlank |= b; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4;
-      b=*((UINT32 *)(pCtvTile+4)); nBlank |= b; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4;
-   }
-
-   return nBlank == 0;
-}
-
-
-static INT32 CtvDo216__fb()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (16); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-       )
-   {
-      pPix = pCtvLine;
-      b=*((UINT32 *)(pCtvTile+4)); nBlank |= b; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4;
-      b=*((UINT32 *)(pCtvTile+0)); nBlank |= b; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4;
-   }
-
-   return nBlank == 0;
-}
-
-
-
-
-
-static INT32 CtvDo216_c_b()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (16); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-       )
-   {
-
-      UINT32 rx = nCtvRollX;
-
-
-
-
-
-
-
-      if (nCtvRollY & 0x20004000) { nCtvRollY += 0x7fff; continue; } else nCtvRollY += 0x7fff;
-
-
-
-      pPix = pCtvLine;
-      b=*((UINT32 *)(pCtvTile+0)); nBlank |= b; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff;
-      b=*((UINT32 *)(pCtvTile+4)); nBlank |= b; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff;
-   }
-
-   return nBlank == 0;
-}
-
-
-static INT32 CtvDo216_cfb()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (16); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-       )
-   {
-
-      UINT32 rx = nCtvRollX;
-
-
-
-
-
-
-
-      if (nCtvRollY & 0x20004000) { nCtvRollY += 0x7fff; continue; } else nCtvRollY += 0x7fff;
-
-
-
-      pPix = pCtvLine;
-      b=*((UINT32 *)(pCtvTile+4)); nBlank |= b; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff;
-      b=*((UINT32 *)(pCtvTile+0)); nBlank |= b; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff;
-   }
-
-   return nBlank == 0;
-}
-static INT32 CtvDo232___b()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (32); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-       )
-   {
-      pPix = pCtvLine;
-      b=*((UINT32 *)(pCtvTile+ 0)); nBlank |= b; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4;
-      b=*((UINT32 *)(pCtvTile+ 4)); nBlank |= b; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4;
-      b=*((UINT32 *)(pCtvTile+ 8)); nBlank |= b; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4;
-      b=*((UINT32 *)(pCtvTile+12)); nBlank |= b; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4;
-   }
-
-   return nBlank == 0;
-}
-
-
-static INT32 CtvDo232__fb()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (32); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-       )
-   {
-      pPix = pCtvLine;
-      b=*((UINT32 *)(pCtvTile+12)); nBlank |= b; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4;
-      b=*((UINT32 *)(pCtvTile+ 8)); nBlank |= b; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4;
-      b=*((UINT32 *)(pCtvTile+ 4)); nBlank |= b; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4;
-      b=*((UINT32 *)(pCtvTile+ 0)); nBlank |= b; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4;
-   }
-
-   return nBlank == 0;
-}
-
-
-
-
-
-static INT32 CtvDo232_c_b()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (32); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-       )
-   {
-
-      UINT32 rx = nCtvRollX;
-
-
-
-
-
-
-
-      if (nCtvRollY & 0x20004000) { nCtvRollY += 0x7fff; continue; } else nCtvRollY += 0x7fff;
-
-
-
-      pPix = pCtvLine;
-      b=*((UINT32 *)(pCtvTile+ 0)); nBlank |= b; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff;
-      b=*((UINT32 *)(pCtvTile+ 4)); nBlank |= b; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff;
-      b=*((UINT32 *)(pCtvTile+ 8)); nBlank |= b; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff;
-      b=*((UINT32 *)(pCtvTile+12)); nBlank |= b; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b >> 28); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b <<= 4; rx += 0x7fff;
-   }
-
-   return nBlank == 0;
-}
-
-
-static INT32 CtvDo232_cfb()
-{
-   INT32 y;
-   UINT32 *ctp;
-   UINT32 nBlank = 0;
-
-   UINT32 b;
-   UINT32 c;
-   UINT8 *pPix;
-
-
-
-
-
-   ctp = CpstPal;
-
-   for (y = 0; y < (32); y++, pCtvLine += nBurnPitch, pCtvTile += nCtvTileAdd
-       )
-   {
-
-      UINT32 rx = nCtvRollX;
-
-
-
-
-
-
-
-      if (nCtvRollY & 0x20004000) { nCtvRollY += 0x7fff; continue; } else nCtvRollY += 0x7fff;
-
-
-
-      pPix = pCtvLine;
-      b=*((UINT32 *)(pCtvTile+12)); nBlank |= b; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff;
-      b=*((UINT32 *)(pCtvTile+ 8)); nBlank |= b; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff;
-      b=*((UINT32 *)(pCtvTile+ 4)); nBlank |= b; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff;
-      b=*((UINT32 *)(pCtvTile+ 0)); nBlank |= b; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff; if ((rx & 0x20004000) == 0) { c = (b & 15); if (c && CpstPmsk & (1 << (c ^ 15))) { c = ctp[c]; { *((UINT16 *)pPix)=(UINT16)c; } } } pPix+=2; b >>= 4; rx += 0x7fff;
-   }
-
-   return nBlank == 0;
-}
-static INT32 CtvDo_______() { return 0; }
-
-
-
-
-static CtvDoFn CtvDo2[0x20]={
+// Tile run variants for cpst.c - each expands ctv_do.h with a fixed set of CU_* options
+
+static void CtvDo_______(struct CpstCmd *pCmd, INT32 nCount) { }
+
+#define CU_BPP   2
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo208____(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo208__f_(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo208_c__(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo208_cf_(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo216____(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo216__f_(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo216_c__(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo216_cf_(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  1
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo216r___(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  1
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo216r_f_(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  1
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo216rc__(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  1
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo216rcf_(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo232____(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo232__f_(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo232_c__(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo232_cf_(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo208___m(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo208__fm(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo208_c_m(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo208_cfm(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo216___m(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo216__fm(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo216_c_m(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo216_cfm(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo232___m(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo232__fm(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo232_c_m(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo232_cfm(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  2
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo216___z(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  2
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo216__fz(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  2
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo216_c_z(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  2
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo216_cfz(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+// Indexed by (nType & 0x7e) | (nFlip & 1)
+static CtvDoFn CtvDo2[0x80]={
    CtvDo208____,CtvDo208__f_,CtvDo208_c__,CtvDo208_cf_,
    CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
    CtvDo216____,CtvDo216__f_,CtvDo216_c__,CtvDo216_cf_,
@@ -1655,9 +620,6 @@ static CtvDoFn CtvDo2[0x20]={
    CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
    CtvDo232____,CtvDo232__f_,CtvDo232_c__,CtvDo232_cf_,
    CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
-};
-
-static CtvDoFn CtvDo2m[0x20]={
    CtvDo208___m,CtvDo208__fm,CtvDo208_c_m,CtvDo208_cfm,
    CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
    CtvDo216___m,CtvDo216__fm,CtvDo216_c_m,CtvDo216_cfm,
@@ -1666,20 +628,4536 @@ static CtvDoFn CtvDo2m[0x20]={
    CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
    CtvDo232___m,CtvDo232__fm,CtvDo232_c_m,CtvDo232_cfm,
    CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo216___z,CtvDo216__fz,CtvDo216_c_z,CtvDo216_cfz,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+};
+
+// Variants reading the 8bpp tile cache
+
+#define CU_BPP   2
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo208____g(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo208__f_g(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo208_c__g(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo208_cf_g(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo216____g(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo216__f_g(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo216_c__g(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo216_cf_g(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  1
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo216r___g(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  1
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo216r_f_g(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  1
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo216rc__g(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  1
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo216rcf_g(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo232____g(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo232__f_g(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo232_c__g(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo232_cf_g(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo208___mg(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo208__fmg(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo208_c_mg(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo208_cfmg(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo216___mg(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo216__fmg(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo216_c_mg(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo216_cfmg(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo232___mg(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo232__fmg(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo232_c_mg(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo232_cfmg(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  2
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo216___zg(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  2
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo216__fzg(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  2
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo216_c_zg(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  2
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo216_cfzg(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+// Indexed by (nType & 0x7e) | (nFlip & 1)
+static CtvDoFn CtvDo2g[0x80]={
+   CtvDo208____g,CtvDo208__f_g,CtvDo208_c__g,CtvDo208_cf_g,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo216____g,CtvDo216__f_g,CtvDo216_c__g,CtvDo216_cf_g,
+   CtvDo216r___g,CtvDo216r_f_g,CtvDo216rc__g,CtvDo216rcf_g,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo232____g,CtvDo232__f_g,CtvDo232_c__g,CtvDo232_cf_g,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo208___mg,CtvDo208__fmg,CtvDo208_c_mg,CtvDo208_cfmg,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo216___mg,CtvDo216__fmg,CtvDo216_c_mg,CtvDo216_cfmg,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo232___mg,CtvDo232__fmg,CtvDo232_c_mg,CtvDo232_cfmg,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo216___zg,CtvDo216__fzg,CtvDo216_c_zg,CtvDo216_cfzg,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+};
+
+// 32 bit variants
+
+#define CU_BPP   4
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo408____(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo408__f_(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo408_c__(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo408_cf_(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo416____(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo416__f_(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo416_c__(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo416_cf_(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  1
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo416r___(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  1
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo416r_f_(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  1
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo416rc__(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  1
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo416rcf_(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo432____(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo432__f_(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo432_c__(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo432_cf_(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo408___m(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo408__fm(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo408_c_m(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo408_cfm(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo416___m(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo416__fm(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo416_c_m(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo416_cfm(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo432___m(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo432__fm(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo432_c_m(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo432_cfm(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  2
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo416___z(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  2
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo416__fz(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  2
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo416_c_z(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  2
+#define CU_SIMD  0
+#define CU_GFX8  0
+static void CtvDo416_cfz(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+// Indexed by (nType & 0x7e) | (nFlip & 1)
+static CtvDoFn CtvDo4[0x80]={
+   CtvDo408____,CtvDo408__f_,CtvDo408_c__,CtvDo408_cf_,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo416____,CtvDo416__f_,CtvDo416_c__,CtvDo416_cf_,
+   CtvDo416r___,CtvDo416r_f_,CtvDo416rc__,CtvDo416rcf_,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo432____,CtvDo432__f_,CtvDo432_c__,CtvDo432_cf_,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo408___m,CtvDo408__fm,CtvDo408_c_m,CtvDo408_cfm,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo416___m,CtvDo416__fm,CtvDo416_c_m,CtvDo416_cfm,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo432___m,CtvDo432__fm,CtvDo432_c_m,CtvDo432_cfm,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo416___z,CtvDo416__fz,CtvDo416_c_z,CtvDo416_cfz,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+};
+
+#define CU_BPP   4
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo408____g(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo408__f_g(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo408_c__g(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo408_cf_g(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo416____g(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo416__f_g(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo416_c__g(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo416_cf_g(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  1
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo416r___g(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  1
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo416r_f_g(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  1
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo416rc__g(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  1
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo416rcf_g(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo432____g(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo432__f_g(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo432_c__g(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo432_cf_g(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo408___mg(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo408__fmg(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo408_c_mg(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo408_cfmg(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo416___mg(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo416__fmg(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo416_c_mg(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo416_cfmg(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo432___mg(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo432__fmg(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo432_c_mg(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo432_cfmg(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  2
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo416___zg(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  2
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo416__fzg(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  2
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo416_c_zg(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  2
+#define CU_SIMD  0
+#define CU_GFX8  1
+static void CtvDo416_cfzg(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+// Indexed by (nType & 0x7e) | (nFlip & 1)
+static CtvDoFn CtvDo4g[0x80]={
+   CtvDo408____g,CtvDo408__f_g,CtvDo408_c__g,CtvDo408_cf_g,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo416____g,CtvDo416__f_g,CtvDo416_c__g,CtvDo416_cf_g,
+   CtvDo416r___g,CtvDo416r_f_g,CtvDo416rc__g,CtvDo416rcf_g,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo432____g,CtvDo432__f_g,CtvDo432_c__g,CtvDo432_cf_g,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo408___mg,CtvDo408__fmg,CtvDo408_c_mg,CtvDo408_cfmg,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo416___mg,CtvDo416__fmg,CtvDo416_c_mg,CtvDo416_cfmg,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo432___mg,CtvDo432__fmg,CtvDo432_c_mg,CtvDo432_cfmg,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo416___zg,CtvDo416__fzg,CtvDo416_c_zg,CtvDo416_cfzg,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+};
+
+#if defined(CTV_SIMD)
+
+#define CU_BPP   2
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo208____v(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo208__f_v(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo208_c__v(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo208_cf_v(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo216____v(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo216__f_v(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo216_c__v(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo216_cf_v(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  1
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo216r___v(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  1
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo216r_f_v(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  1
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo216rc__v(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  1
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo216rcf_v(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo232____v(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo232__f_v(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo232_c__v(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo232_cf_v(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo208___mv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo208__fmv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo208_c_mv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo208_cfmv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo216___mv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo216__fmv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo216_c_mv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo216_cfmv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo232___mv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo232__fmv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo232_c_mv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo232_cfmv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  2
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo216___zv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  2
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo216__fzv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  2
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo216_c_zv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  2
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo216_cfzv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+// Indexed by (nType & 0x7e) | (nFlip & 1)
+static CtvDoFn CtvDo2v[0x80]={
+   CtvDo208____v,CtvDo208__f_v,CtvDo208_c__v,CtvDo208_cf_v,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo216____v,CtvDo216__f_v,CtvDo216_c__v,CtvDo216_cf_v,
+   CtvDo216r___v,CtvDo216r_f_v,CtvDo216rc__v,CtvDo216rcf_v,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo232____v,CtvDo232__f_v,CtvDo232_c__v,CtvDo232_cf_v,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo208___mv,CtvDo208__fmv,CtvDo208_c_mv,CtvDo208_cfmv,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo216___mv,CtvDo216__fmv,CtvDo216_c_mv,CtvDo216_cfmv,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo232___mv,CtvDo232__fmv,CtvDo232_c_mv,CtvDo232_cfmv,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo216___zv,CtvDo216__fzv,CtvDo216_c_zv,CtvDo216_cfzv,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+};
+
+#define CU_BPP   2
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo208____gv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo208__f_gv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo208_c__gv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo208_cf_gv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo216____gv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo216__f_gv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo216_c__gv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo216_cf_gv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  1
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo216r___gv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  1
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo216r_f_gv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  1
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo216rc__gv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  1
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo216rcf_gv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo232____gv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo232__f_gv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo232_c__gv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo232_cf_gv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo208___mgv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo208__fmgv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo208_c_mgv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo208_cfmgv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo216___mgv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo216__fmgv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo216_c_mgv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo216_cfmgv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo232___mgv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo232__fmgv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo232_c_mgv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo232_cfmgv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  2
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo216___zgv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  2
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo216__fzgv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  2
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo216_c_zgv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   2
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  2
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo216_cfzgv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+// Indexed by (nType & 0x7e) | (nFlip & 1)
+static CtvDoFn CtvDo2gv[0x80]={
+   CtvDo208____gv,CtvDo208__f_gv,CtvDo208_c__gv,CtvDo208_cf_gv,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo216____gv,CtvDo216__f_gv,CtvDo216_c__gv,CtvDo216_cf_gv,
+   CtvDo216r___gv,CtvDo216r_f_gv,CtvDo216rc__gv,CtvDo216rcf_gv,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo232____gv,CtvDo232__f_gv,CtvDo232_c__gv,CtvDo232_cf_gv,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo208___mgv,CtvDo208__fmgv,CtvDo208_c_mgv,CtvDo208_cfmgv,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo216___mgv,CtvDo216__fmgv,CtvDo216_c_mgv,CtvDo216_cfmgv,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo232___mgv,CtvDo232__fmgv,CtvDo232_c_mgv,CtvDo232_cfmgv,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo216___zgv,CtvDo216__fzgv,CtvDo216_c_zgv,CtvDo216_cfzgv,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
 };
 
-static CtvDoFn CtvDo2b[0x20]={
-   CtvDo208___b,CtvDo208__fb,CtvDo208_c_b,CtvDo208_cfb,
+#define CU_BPP   4
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo408____v(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo408__f_v(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo408_c__v(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo408_cf_v(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo416____v(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo416__f_v(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo416_c__v(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo416_cf_v(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  1
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo416r___v(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  1
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo416r_f_v(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  1
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo416rc__v(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  1
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo416rcf_v(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo432____v(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo432__f_v(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo432_c__v(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo432_cf_v(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo408___mv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo408__fmv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo408_c_mv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo408_cfmv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo416___mv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo416__fmv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo416_c_mv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo416_cfmv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo432___mv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo432__fmv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo432_c_mv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo432_cfmv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  2
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo416___zv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  2
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo416__fzv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  2
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo416_c_zv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  2
+#define CU_SIMD  1
+#define CU_GFX8  0
+static CTV_SIMD void CtvDo416_cfzv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+// Indexed by (nType & 0x7e) | (nFlip & 1)
+static CtvDoFn CtvDo4v[0x80]={
+   CtvDo408____v,CtvDo408__f_v,CtvDo408_c__v,CtvDo408_cf_v,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo416____v,CtvDo416__f_v,CtvDo416_c__v,CtvDo416_cf_v,
+   CtvDo416r___v,CtvDo416r_f_v,CtvDo416rc__v,CtvDo416rcf_v,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo432____v,CtvDo432__f_v,CtvDo432_c__v,CtvDo432_cf_v,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo408___mv,CtvDo408__fmv,CtvDo408_c_mv,CtvDo408_cfmv,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo416___mv,CtvDo416__fmv,CtvDo416_c_mv,CtvDo416_cfmv,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo432___mv,CtvDo432__fmv,CtvDo432_c_mv,CtvDo432_cfmv,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo416___zv,CtvDo416__fzv,CtvDo416_c_zv,CtvDo416_cfzv,
    CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
-   CtvDo216___b,CtvDo216__fb,CtvDo216_c_b,CtvDo216_cfb,
    CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
    CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
    CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
-   CtvDo232___b,CtvDo232__fb,CtvDo232_c_b,CtvDo232_cfb,
    CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
 };
 
+#define CU_BPP   4
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo408____gv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo408__f_gv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo408_c__gv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo408_cf_gv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo416____gv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo416__f_gv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo416_c__gv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo416_cf_gv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  1
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo416r___gv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  1
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo416r_f_gv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  1
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo416rc__gv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  1
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo416rcf_gv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo432____gv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo432__f_gv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo432_c__gv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  0
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo432_cf_gv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo408___mgv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo408__fmgv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo408_c_mgv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  8
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo408_cfmgv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo416___mgv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo416__fmgv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo416_c_mgv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo416_cfmgv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo432___mgv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo432__fmgv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo432_c_mgv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  32
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  1
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo432_cfmgv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 0
+#define CU_MASK  2
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo416___zgv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  0
+#define CU_FLIPX 1
+#define CU_MASK  2
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo416__fzgv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 0
+#define CU_MASK  2
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo416_c_zgv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+#define CU_BPP   4
+#define CU_SIZE  16
+#define CU_ROWS  0
+#define CU_CARE  1
+#define CU_FLIPX 1
+#define CU_MASK  2
+#define CU_SIMD  1
+#define CU_GFX8  1
+static CTV_SIMD void CtvDo416_cfzgv(struct CpstCmd *pCmd, INT32 nCount)
+#include "ctv_do.h"
+#undef CU_GFX8
+#undef CU_SIMD
+#undef CU_MASK
+#undef CU_FLIPX
+#undef CU_CARE
+#undef CU_ROWS
+#undef CU_SIZE
+#undef CU_BPP
+
+// Indexed by (nType & 0x7e) | (nFlip & 1)
+static CtvDoFn CtvDo4gv[0x80]={
+   CtvDo408____gv,CtvDo408__f_gv,CtvDo408_c__gv,CtvDo408_cf_gv,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo416____gv,CtvDo416__f_gv,CtvDo416_c__gv,CtvDo416_cf_gv,
+   CtvDo416r___gv,CtvDo416r_f_gv,CtvDo416rc__gv,CtvDo416rcf_gv,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo432____gv,CtvDo432__f_gv,CtvDo432_c__gv,CtvDo432_cf_gv,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo408___mgv,CtvDo408__fmgv,CtvDo408_c_mgv,CtvDo408_cfmgv,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo416___mgv,CtvDo416__fmgv,CtvDo416_c_mgv,CtvDo416_cfmgv,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo432___mgv,CtvDo432__fmgv,CtvDo432_c_mgv,CtvDo432_cfmgv,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo416___zgv,CtvDo416__fzgv,CtvDo416_c_zgv,CtvDo416_cfzgv,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+   CtvDo_______,CtvDo_______,CtvDo_______,CtvDo_______,
+};
 
-CtvDoFn CtvDoX[0x20];
-CtvDoFn CtvDoXM[0x20];
-CtvDoFn CtvDoXB[0x20];
+#endif